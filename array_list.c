@@ -2,9 +2,24 @@
 #include <stdlib.h>
 #include <sys/types.h>
 #include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <stdatomic.h>
 #include "array_list.h"
+#include "simd_search.h"
+#include "thread_pool.h"
+
+#ifndef SSIZE_MAX
+#define SSIZE_MAX ((ssize_t)(SIZE_MAX / 2))
+#endif
 
 array_list* create_array_list(ssize_t array_size){
+    return create_array_list_with(array_size, NULL);
+}
+
+array_list* create_array_list_with(ssize_t array_size, const ds_allocator* allocator){
+    if (allocator == NULL) allocator = ds_default_allocator();
+
     ssize_t size;
     // check if init_size is specified, if it <= 0 a default size of 10 is used
     if (array_size > 0) 
@@ -12,16 +27,27 @@ array_list* create_array_list(ssize_t array_size){
     else 
         size = 10;
 
-    array_list* list = malloc(sizeof(array_list));
+    if ((size_t)size > SIZE_MAX / sizeof(void*)) return NULL;
+
+    array_list* list = allocator->alloc(allocator->ctx, sizeof(array_list));
 
     if (list == NULL) return NULL;
 
-    list->arr = malloc(sizeof(void*) * size);
+    list->arr = allocator->alloc(allocator->ctx, sizeof(void*) * size);
 
-    if (list->arr == NULL) return NULL;
+    if (list->arr == NULL){
+        allocator->free(allocator->ctx, list, sizeof(array_list));
+        return NULL;
+    }
 
     list->length = 0;
     list->max_size = size;
+    list->growth = AL_GROW_DOUBLE;
+    list->growth_chunk = 0;
+    list->min_size = size;
+    list->auto_shrink = 0;
+    list->allocator = allocator;
+    DS_STAT_RESET(list, 0, size);
 
     return list;
 }
@@ -37,25 +63,50 @@ void free_array_list(array_list *list, void (*free_element) (void*)){
             current_index++;
     }
     }
-    free(list->arr);
-    free(list);
+    const ds_allocator* allocator = list->allocator;
+
+    allocator->free(allocator->ctx, list->arr, list->max_size * sizeof(void*));
+    allocator->free(allocator->ctx, list, sizeof(array_list));
 }
 
 ssize_t alget_index(const array_list *list, void *element, int (*compare)(void *, void *)){
     if (list == NULL || element == NULL || compare == NULL) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
    
     ssize_t current_index = 0;
     
     while (current_index < list->length){
-        if (compare(list->arr[current_index], element) == 0)
+        if (compare(list->arr[current_index], element) == 0){
+            DS_STAT_ADD(list, traversal_steps, current_index + 1);
             return current_index;
+        }
 
         current_index++;
     }
 
+    DS_STAT_ADD(list, traversal_steps, list->length);
+
     return -1;
 }
 
+ssize_t alfind_ptr(const array_list *list, const void* element){
+    if (list == NULL || element == NULL) return -1;
+
+    ssize_t index;
+
+    // pointers are searched as plain integers of the same width
+    if (sizeof(void*) == sizeof(uint64_t))
+        index = simd_find_u64(list->arr, list->length, (uint64_t)(uintptr_t)element);
+    else
+        index = simd_find_u32(list->arr, list->length, (uint32_t)(uintptr_t)element);
+
+    DS_STAT_ADD(list, operations, 1);
+    DS_STAT_ADD(list, traversal_steps, (index == -1 ? list->length : index + 1));
+
+    return index;
+}
+
 void alprint(const array_list *list, void (*print_element)(void *)){
    if (list == NULL || list->length == 0 || print_element == NULL) {
         printf("[]\n");
@@ -95,12 +146,15 @@ void alreverse(array_list *list){
 
 void *alget(const array_list *list, ssize_t index){
     if (list == NULL || index < 0 || index >= list->length) return NULL;
+    DS_STAT_ADD(list, operations, 1);
     return list->arr[index];
 }
 
 int alset(array_list *list, ssize_t index, void *element, void (*free_element) (void*)){
     if (list == NULL || element == NULL || index < 0 || index >= list->length) return -1;
 
+    DS_STAT_ADD(list, operations, 1);
+
     if (free_element != NULL) free_element(list->arr[index]);
 
     list->arr[index] = element;
@@ -108,15 +162,66 @@ int alset(array_list *list, ssize_t index, void *element, void (*free_element) (
     return 0;
 }
 
-int resize_list(array_list* list){
-    if (list == NULL) return -1;
-    void **new_arr = realloc(list->arr, list->max_size * 2 * sizeof(void*)); // resizing the array to double the old size
+// capacity after growing until at least needed elements fit, -1 when that would overflow
+static ssize_t grown_capacity(const array_list* list, ssize_t needed){
+    ssize_t new_size = list->max_size;
+
+    if (list->growth == AL_GROW_CHUNK){
+        ssize_t chunks = (needed - new_size + list->growth_chunk - 1) / list->growth_chunk;
+        if (chunks > (SSIZE_MAX - new_size) / list->growth_chunk) return -1;
+        new_size += chunks * list->growth_chunk;
+    } else {
+        while (new_size < needed){
+            ssize_t step = (list->growth == AL_GROW_HALF ? new_size / 2 : new_size);
+            if (step < 1) step = 1;
+            if (step > SSIZE_MAX - new_size) return -1;
+            new_size += step;
+        }
+    }
+
+    if ((size_t)new_size > SIZE_MAX / sizeof(void*)) return -1;
+
+    return new_size;
+}
+
+static int set_capacity(array_list* list, ssize_t new_size){
+    const ds_allocator* allocator = list->allocator;
+    void **new_arr = allocator->realloc(allocator->ctx, list->arr, list->max_size * sizeof(void*), new_size * sizeof(void*));
     if (new_arr == NULL) return -1;
-    list->arr = new_arr;  
-    list->max_size *= 2;
+    list->arr = new_arr;
+    list->max_size = new_size;
+    DS_STAT_ADD(list, reallocations, 1);
+    DS_STAT_PEAK(list, peak_capacity, new_size);
     return 0;
 }
 
+// grow the array following the growth policy until it can hold needed elements
+static int ensure_capacity(array_list* list, ssize_t needed){
+    if (needed <= list->max_size) return 0;
+
+    ssize_t new_size = grown_capacity(list, needed);
+    if (new_size == -1) return -1;
+
+    return set_capacity(list, new_size);
+}
+
+// halve the capacity while the list fills a quarter of it or less
+static void maybe_shrink(array_list* list){
+    if (!list->auto_shrink) return;
+
+    ssize_t new_size = list->max_size;
+    while (list->length <= new_size / 4 && new_size / 2 >= list->min_size) new_size /= 2;
+
+    // a failed shrink just keeps the bigger array
+    if (new_size != list->max_size) set_capacity(list, new_size);
+}
+
+int resize_list(array_list* list){
+    if (list == NULL) return -1;
+    if (list->max_size == SSIZE_MAX) return -1;
+    return ensure_capacity(list, list->max_size + 1);
+}
+
 int alappend(array_list *list, void* element){
     if (list == NULL || element == NULL) return -1;
     if (list->length >= list->max_size)
@@ -124,6 +229,8 @@ int alappend(array_list *list, void* element){
 
     list->arr[list->length] = element;
     list->length++;
+    DS_STAT_ADD(list, operations, 1);
+    DS_STAT_PEAK(list, peak_length, list->length);
     
     return 0;
 }
@@ -141,6 +248,9 @@ int aladd(array_list *list, ssize_t index, void* element){
 
     list->arr[index] = element;
     list->length++;
+    DS_STAT_ADD(list, operations, 1);
+    DS_STAT_ADD(list, bytes_moved, copy_size);
+    DS_STAT_PEAK(list, peak_length, list->length);
 
     return 0;
 }
@@ -152,6 +262,8 @@ int alpop(array_list *list, void (*free_element)(void*)){
     if (free_element != NULL) free_element(list->arr[list->length-1]);
 
     list->length--;
+    DS_STAT_ADD(list, operations, 1);
+    maybe_shrink(list);
 
     return 0;
 }
@@ -168,6 +280,668 @@ int aldelete(array_list *list, ssize_t index, void (*free_element)(void*)){
     memmove(dest, src , copy_size);
 
     list->length--;
+    DS_STAT_ADD(list, operations, 1);
+    DS_STAT_ADD(list, bytes_moved, copy_size);
+    maybe_shrink(list);
 
     return 0;
 }
+
+static int has_null(void** elements, ssize_t count){
+    for (ssize_t i = 0; i < count; i++)
+        if (elements[i] == NULL) return 1;
+    return 0;
+}
+
+int alextend(array_list *list, void** elements, ssize_t count){
+    if (list == NULL || elements == NULL || count < 0) return -1;
+    if (count > SSIZE_MAX - list->length || has_null(elements, count)) return -1;
+    if (ensure_capacity(list, list->length + count) == -1) return -1;
+
+    memcpy(&list->arr[list->length], elements, count * sizeof(void*));
+    list->length += count;
+    DS_STAT_ADD(list, operations, 1);
+    DS_STAT_ADD(list, bytes_moved, count * sizeof(void*));
+    DS_STAT_PEAK(list, peak_length, list->length);
+
+    return 0;
+}
+
+int aladd_range(array_list *list, ssize_t index, void** elements, ssize_t count){
+    if (list == NULL || elements == NULL || count < 0 || index < 0 || index > list->length) return -1;
+    if (count > SSIZE_MAX - list->length || has_null(elements, count)) return -1;
+    if (ensure_capacity(list, list->length + count) == -1) return -1;
+
+    // shift the tail once by count positions, then drop the new elements in the gap
+    memmove(&list->arr[index + count], &list->arr[index], (list->length - index) * sizeof(void*));
+    memcpy(&list->arr[index], elements, count * sizeof(void*));
+    DS_STAT_ADD(list, operations, 1);
+    DS_STAT_ADD(list, bytes_moved, (list->length - index + count) * sizeof(void*));
+    list->length += count;
+    DS_STAT_PEAK(list, peak_length, list->length);
+
+    return 0;
+}
+
+int aldelete_range(array_list *list, ssize_t index, ssize_t count, void (*free_element)(void*)){
+    if (list == NULL || count < 0 || index < 0 || index > list->length || count > list->length - index) return -1;
+
+    if (free_element != NULL)
+        for (ssize_t i = index; i < index + count; i++)
+            free_element(list->arr[i]);
+
+    memmove(&list->arr[index], &list->arr[index + count], (list->length - index - count) * sizeof(void*));
+    DS_STAT_ADD(list, operations, 1);
+    DS_STAT_ADD(list, bytes_moved, (list->length - index - count) * sizeof(void*));
+    list->length -= count;
+    maybe_shrink(list);
+
+    return 0;
+}
+
+// ----------------- capacity control -----------------
+
+int alset_growth(array_list *list, al_growth_policy policy, ssize_t chunk){
+    if (list == NULL) return -1;
+    if (policy != AL_GROW_DOUBLE && policy != AL_GROW_HALF && policy != AL_GROW_CHUNK) return -1;
+    if (policy == AL_GROW_CHUNK && chunk <= 0) return -1;
+
+    list->growth = policy;
+    list->growth_chunk = (policy == AL_GROW_CHUNK ? chunk : 0);
+
+    return 0;
+}
+
+int alreserve(array_list *list, ssize_t capacity){
+    if (list == NULL || capacity < 0) return -1;
+    if ((size_t)capacity > SIZE_MAX / sizeof(void*)) return -1;
+    // a reserved capacity is kept by auto shrink too
+    if (capacity > list->min_size) list->min_size = capacity;
+    if (capacity <= list->max_size) return 0;
+
+    return set_capacity(list, capacity);
+}
+
+int alshrink_to_fit(array_list *list){
+    if (list == NULL) return -1;
+
+    ssize_t new_size = (list->length > 0 ? list->length : 1);
+    list->min_size = new_size;
+    if (new_size == list->max_size) return 0;
+
+    return set_capacity(list, new_size);
+}
+
+int alset_auto_shrink(array_list *list, int enabled){
+    if (list == NULL) return -1;
+
+    list->auto_shrink = (enabled != 0);
+    maybe_shrink(list);
+
+    return 0;
+}
+
+// ----------------- sorting and binary search -----------------
+
+// ranges at most this long are finished with insertion sort
+#define SORT_INSERTION_THRESHOLD 16
+
+static void insertion_sort(void** arr, ssize_t low, ssize_t high, int (*compare)(void*, void*)){
+    for (ssize_t i = low + 1; i < high; i++){
+        void* element = arr[i];
+        ssize_t j = i;
+
+        // strictly greater only, so equal elements never pass each other
+        while (j > low && compare(arr[j - 1], element) > 0){
+            arr[j] = arr[j - 1];
+            j--;
+        }
+        arr[j] = element;
+    }
+}
+
+static void sift_down(void** arr, ssize_t root, ssize_t count, int (*compare)(void*, void*)){
+    while (root * 2 + 1 < count){
+        ssize_t child = root * 2 + 1;
+
+        if (child + 1 < count && compare(arr[child], arr[child + 1]) < 0) child++;
+        if (compare(arr[root], arr[child]) >= 0) return;
+
+        swap(&arr[root], &arr[child]);
+        root = child;
+    }
+}
+
+static void heap_sort(void** arr, ssize_t count, int (*compare)(void*, void*)){
+    for (ssize_t i = count / 2 - 1; i >= 0; i--) sift_down(arr, i, count, compare);
+
+    for (ssize_t end = count - 1; end > 0; end--){
+        swap(&arr[0], &arr[end]);
+        sift_down(arr, 0, end, compare);
+    }
+}
+
+static void introsort(void** arr, ssize_t low, ssize_t high, int depth_limit, int (*compare)(void*, void*)){
+    while (high - low > SORT_INSERTION_THRESHOLD){
+        if (depth_limit-- == 0){
+            heap_sort(&arr[low], high - low, compare);
+            return;
+        }
+
+        // median of three moved to low, which also guards both scans below
+        ssize_t mid = low + (high - low) / 2;
+        if (compare(arr[mid], arr[low]) < 0) swap(&arr[mid], &arr[low]);
+        if (compare(arr[high - 1], arr[low]) < 0) swap(&arr[high - 1], &arr[low]);
+        if (compare(arr[high - 1], arr[mid]) < 0) swap(&arr[high - 1], &arr[mid]);
+        swap(&arr[low], &arr[mid]);
+
+        // hoare partition, stopping on equal elements keeps runs of duplicates balanced
+        void* pivot = arr[low];
+        ssize_t i = low, j = high;
+        while (1){
+            while (compare(arr[++i], pivot) < 0 && i < high - 1);
+            while (compare(pivot, arr[--j]) < 0);
+            if (i >= j) break;
+            swap(&arr[i], &arr[j]);
+        }
+        swap(&arr[low], &arr[j]);
+
+        // recurse into the smaller side, loop on the larger one to bound the stack
+        if (j - low < high - j - 1){
+            introsort(arr, low, j, depth_limit, compare);
+            low = j + 1;
+        } else {
+            introsort(arr, j + 1, high, depth_limit, compare);
+            high = j;
+        }
+    }
+
+    insertion_sort(arr, low, high, compare);
+}
+
+int alsort(array_list *list, int (*compare) (void*, void*)){
+    if (list == NULL || compare == NULL) return -1;
+
+    int depth_limit = 0;
+    for (ssize_t n = list->length; n > 1; n >>= 1) depth_limit += 2;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    introsort(list->arr, 0, list->length, depth_limit, compare);
+
+    return 0;
+}
+
+// merge the sorted runs [low, mid) and [mid, high), the left run is copied out to buffer
+static void merge_runs(void** arr, void** buffer, ssize_t low, ssize_t mid, ssize_t high, int (*compare)(void*, void*)){
+    // already in order, nothing to merge
+    if (compare(arr[mid - 1], arr[mid]) <= 0) return;
+
+    ssize_t left_length = mid - low;
+    memcpy(buffer, &arr[low], left_length * sizeof(void*));
+
+    ssize_t i = 0, j = mid, k = low;
+    while (i < left_length && j < high){
+        // take from the left run on ties to keep the sort stable
+        if (compare(arr[j], buffer[i]) < 0) arr[k++] = arr[j++];
+        else arr[k++] = buffer[i++];
+    }
+
+    memcpy(&arr[k], &buffer[i], (left_length - i) * sizeof(void*));
+}
+
+static void merge_sort(void** arr, void** buffer, ssize_t low, ssize_t high, int (*compare)(void*, void*)){
+    if (high - low <= SORT_INSERTION_THRESHOLD){
+        insertion_sort(arr, low, high, compare);
+        return;
+    }
+
+    ssize_t mid = low + (high - low) / 2;
+    merge_sort(arr, buffer, low, mid, compare);
+    merge_sort(arr, buffer, mid, high, compare);
+    merge_runs(arr, buffer, low, mid, high, compare);
+}
+
+int alsort_stable(array_list *list, int (*compare) (void*, void*)){
+    if (list == NULL || compare == NULL) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    if (list->length <= SORT_INSERTION_THRESHOLD){
+        insertion_sort(list->arr, 0, list->length, compare);
+        return 0;
+    }
+
+    // the left run of a merge is never longer than half the list (rounded up)
+    const ds_allocator* allocator = list->allocator;
+    size_t buffer_size = ((list->length + 1) / 2) * sizeof(void*);
+    void** buffer = allocator->alloc(allocator->ctx, buffer_size);
+    if (buffer == NULL) return -1;
+
+    merge_sort(list->arr, buffer, 0, list->length, compare);
+
+    allocator->free(allocator->ctx, buffer, buffer_size);
+
+    return 0;
+}
+
+ssize_t allower_bound(const array_list *list, void* element, int (*compare) (void*, void*)){
+    if (list == NULL || element == NULL || compare == NULL) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    ssize_t low = 0, high = list->length;
+    while (low < high){
+        ssize_t mid = low + (high - low) / 2;
+        DS_STAT_ADD(list, traversal_steps, 1);
+        if (compare(list->arr[mid], element) < 0) low = mid + 1;
+        else high = mid;
+    }
+
+    return low;
+}
+
+ssize_t alupper_bound(const array_list *list, void* element, int (*compare) (void*, void*)){
+    if (list == NULL || element == NULL || compare == NULL) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    ssize_t low = 0, high = list->length;
+    while (low < high){
+        ssize_t mid = low + (high - low) / 2;
+        DS_STAT_ADD(list, traversal_steps, 1);
+        if (compare(list->arr[mid], element) <= 0) low = mid + 1;
+        else high = mid;
+    }
+
+    return low;
+}
+
+ssize_t alsearch_sorted(const array_list *list, void* element, int (*compare) (void*, void*)){
+    ssize_t index = allower_bound(list, element, compare);
+
+    if (index == -1 || index == list->length) return -1;
+    if (compare(list->arr[index], element) != 0) return -1;
+
+    return index;
+}
+
+ssize_t aladd_sorted(array_list *list, void* element, int (*compare) (void*, void*)){
+    ssize_t index = alupper_bound(list, element, compare);
+
+    if (index == -1) return -1;
+    if (aladd(list, index, element) == -1) return -1;
+
+    return index;
+}
+
+// ----------------- parallel -----------------
+
+// state shared by the chunks of a parallel job
+typedef struct {
+    void** arr;          // elements of the source list
+    ssize_t length;      // number of elements
+    ssize_t chunks;      // number of chunks the elements are split into
+    void* ctx;           // user context
+    void (*for_fn) (void*, ssize_t, void*);
+    void* (*map_fn) (void*, void*);
+    int (*keep) (void*, void*);
+    void (*accumulate) (void*, void*, void*);
+    void** out;          // destination array of almap and alfilter
+    unsigned char* kept; // alfilter decisions, one per element
+    ssize_t* offsets;    // alfilter kept count, then first output index, per chunk
+    char* partials;      // alreduce accumulators, one per chunk
+    size_t acc_size;     // size of an alreduce accumulator
+    atomic_int failed;   // set by almap when fn returns NULL
+    int (*compare) (void*, void*);
+    void** buffer;       // alsort_parallel scratch array, as long as the list
+    void** src;          // alsort_parallel runs being merged
+    void** dst;          // alsort_parallel destination of the merged runs
+    ssize_t* bounds;     // alsort_parallel run boundaries, runs + 1 of them
+    ssize_t runs;        // alsort_parallel number of sorted runs in src
+    ssize_t parts;       // alsort_parallel pieces every pair of runs is merged in
+} parallel_job;
+
+// bounds of the chunk'th of job->chunks contiguous ranges, the first length % chunks ones are one longer
+static void chunk_bounds(const parallel_job* job, ssize_t chunk, ssize_t* begin, ssize_t* end){
+    ssize_t base = job->length / job->chunks, extra = job->length % job->chunks;
+
+    *begin = chunk * base + (chunk < extra ? chunk : extra);
+    *end = *begin + base + (chunk < extra ? 1 : 0);
+}
+
+static void for_chunk(void* arg, ssize_t chunk){
+    parallel_job* job = arg;
+    ssize_t begin, end;
+    chunk_bounds(job, chunk, &begin, &end);
+
+    for (ssize_t i = begin; i < end; i++) job->for_fn(job->arr[i], i, job->ctx);
+}
+
+static void map_chunk(void* arg, ssize_t chunk){
+    parallel_job* job = arg;
+    ssize_t begin, end;
+    chunk_bounds(job, chunk, &begin, &end);
+
+    for (ssize_t i = begin; i < end; i++){
+        job->out[i] = job->map_fn(job->arr[i], job->ctx);
+        if (job->out[i] == NULL) atomic_store_explicit(&job->failed, 1, memory_order_relaxed);
+    }
+}
+
+static void filter_mark_chunk(void* arg, ssize_t chunk){
+    parallel_job* job = arg;
+    ssize_t begin, end, count = 0;
+    chunk_bounds(job, chunk, &begin, &end);
+
+    for (ssize_t i = begin; i < end; i++){
+        job->kept[i] = (job->keep(job->arr[i], job->ctx) != 0);
+        count += job->kept[i];
+    }
+
+    job->offsets[chunk] = count;
+}
+
+static void filter_copy_chunk(void* arg, ssize_t chunk){
+    parallel_job* job = arg;
+    ssize_t begin, end, k = job->offsets[chunk];
+    chunk_bounds(job, chunk, &begin, &end);
+
+    for (ssize_t i = begin; i < end; i++)
+        if (job->kept[i]) job->out[k++] = job->arr[i];
+}
+
+static void reduce_chunk(void* arg, ssize_t chunk){
+    parallel_job* job = arg;
+    ssize_t begin, end;
+    chunk_bounds(job, chunk, &begin, &end);
+
+    void* acc = job->partials + (size_t)chunk * job->acc_size;
+    for (ssize_t i = begin; i < end; i++) job->accumulate(acc, job->arr[i], job->ctx);
+}
+
+static parallel_job make_job(const array_list* list, thread_pool* pool, void* ctx){
+    parallel_job job;
+
+    memset(&job, 0, sizeof(job));
+    job.arr = list->arr;
+    job.length = list->length;
+    job.chunks = thread_pool_chunks(pool, list->length);
+    job.ctx = ctx;
+    atomic_init(&job.failed, 0);
+
+    return job;
+}
+
+int alparallel_for(array_list *list, thread_pool *pool, void (*fn) (void* element, ssize_t index, void* ctx), void* ctx){
+    if (list == NULL || fn == NULL) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    parallel_job job = make_job(list, pool, ctx);
+    job.for_fn = fn;
+
+    return thread_pool_run(pool, job.chunks, for_chunk, &job);
+}
+
+array_list* almap(const array_list *list, thread_pool *pool, void* (*fn) (void* element, void* ctx), void* ctx){
+    if (list == NULL || fn == NULL) return NULL;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    array_list* result = create_array_list_with(list->length, list->allocator);
+    if (result == NULL) return NULL;
+
+    parallel_job job = make_job(list, pool, ctx);
+    job.map_fn = fn;
+    job.out = result->arr;
+
+    if (thread_pool_run(pool, job.chunks, map_chunk, &job) == -1 || atomic_load(&job.failed)){
+        free_array_list(result, NULL);
+        return NULL;
+    }
+
+    result->length = list->length;
+    DS_STAT_PEAK(result, peak_length, result->length);
+
+    return result;
+}
+
+array_list* alfilter(const array_list *list, thread_pool *pool, int (*keep) (void* element, void* ctx), void* ctx){
+    if (list == NULL || keep == NULL) return NULL;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    const ds_allocator* allocator = list->allocator;
+    parallel_job job = make_job(list, pool, ctx);
+    job.keep = keep;
+
+    size_t kept_size = (size_t)(list->length > 0 ? list->length : 1);
+    size_t offsets_size = (size_t)job.chunks * sizeof(ssize_t);
+    job.kept = allocator->alloc(allocator->ctx, kept_size);
+    job.offsets = allocator->alloc(allocator->ctx, offsets_size);
+
+    array_list* result = NULL;
+
+    if (job.kept == NULL || job.offsets == NULL) goto done;
+    if (thread_pool_run(pool, job.chunks, filter_mark_chunk, &job) == -1) goto done;
+
+    // turn the per chunk counts into the index of each chunk's first kept element
+    ssize_t total = 0;
+    for (ssize_t chunk = 0; chunk < job.chunks; chunk++){
+        ssize_t count = job.offsets[chunk];
+        job.offsets[chunk] = total;
+        total += count;
+    }
+
+    result = create_array_list_with(total, allocator);
+    if (result == NULL) goto done;
+
+    job.out = result->arr;
+
+    if (thread_pool_run(pool, job.chunks, filter_copy_chunk, &job) == -1){
+        free_array_list(result, NULL);
+        result = NULL;
+        goto done;
+    }
+
+    result->length = total;
+    DS_STAT_PEAK(result, peak_length, result->length);
+
+done:
+    allocator->free(allocator->ctx, job.kept, kept_size);
+    allocator->free(allocator->ctx, job.offsets, offsets_size);
+
+    return result;
+}
+
+int alreduce(const array_list *list, thread_pool *pool, void* acc, size_t acc_size,
+             void (*accumulate) (void* acc, void* element, void* ctx),
+             void (*combine) (void* acc, const void* partial, void* ctx), void* ctx){
+    if (list == NULL || acc == NULL || acc_size == 0 || accumulate == NULL || combine == NULL) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    parallel_job job = make_job(list, pool, ctx);
+
+    // a single chunk folds straight into acc
+    if (job.chunks == 1){
+        for (ssize_t i = 0; i < list->length; i++) accumulate(acc, list->arr[i], ctx);
+        return 0;
+    }
+
+    const ds_allocator* allocator = list->allocator;
+
+    if ((size_t)job.chunks > SIZE_MAX / acc_size) return -1;
+    size_t partials_size = (size_t)job.chunks * acc_size;
+
+    job.accumulate = accumulate;
+    job.acc_size = acc_size;
+    job.partials = allocator->alloc(allocator->ctx, partials_size);
+    if (job.partials == NULL) return -1;
+
+    // every chunk starts from the identity held in acc
+    for (ssize_t chunk = 0; chunk < job.chunks; chunk++)
+        memcpy(job.partials + (size_t)chunk * acc_size, acc, acc_size);
+
+    int success = thread_pool_run(pool, job.chunks, reduce_chunk, &job);
+
+    if (success == 0)
+        for (ssize_t chunk = 0; chunk < job.chunks; chunk++)
+            combine(acc, job.partials + (size_t)chunk * acc_size, ctx);
+
+    allocator->free(allocator->ctx, job.partials, partials_size);
+
+    return success;
+}
+
+// sort every chunk on its own, each using its slice of the buffer as scratch
+static void sort_chunk(void* arg, ssize_t chunk){
+    parallel_job* job = arg;
+    ssize_t begin, end;
+    chunk_bounds(job, chunk, &begin, &end);
+
+    merge_sort(job->arr, job->buffer + begin, begin, end, job->compare);
+}
+
+// number of elements of left among the first k of the stable merge of left and right
+static ssize_t merge_split(void** left, ssize_t left_length, void** right, ssize_t right_length, ssize_t k,
+                           int (*compare)(void*, void*)){
+    ssize_t low = (k > right_length ? k - right_length : 0);
+    ssize_t high = (k < left_length ? k : left_length);
+
+    // too few taken from left while the right element before the split doesn't order before left[i]
+    while (low < high){
+        ssize_t i = low + (high - low) / 2;
+        if (compare(right[k - i - 1], left[i]) >= 0) low = i + 1;
+        else high = i;
+    }
+
+    return low;
+}
+
+// one piece of the merge of a pair of runs, the pieces of a pair write disjoint parts of dst
+static void merge_piece(void* arg, ssize_t piece){
+    parallel_job* job = arg;
+    ssize_t pair = piece / job->parts, part = piece % job->parts;
+
+    // an odd run out has no partner and is merged with an empty one, which copies it
+    ssize_t low = job->bounds[2 * pair];
+    ssize_t mid = job->bounds[(2 * pair + 1 < job->runs ? 2 * pair + 1 : job->runs)];
+    ssize_t high = job->bounds[(2 * pair + 2 < job->runs ? 2 * pair + 2 : job->runs)];
+
+    void** left = job->src + low;
+    void** right = job->src + mid;
+    ssize_t left_length = mid - low, right_length = high - mid;
+
+    ssize_t begin = (high - low) * part / job->parts;
+    ssize_t end = (high - low) * (part + 1) / job->parts;
+    ssize_t i = merge_split(left, left_length, right, right_length, begin, job->compare);
+    ssize_t i_end = merge_split(left, left_length, right, right_length, end, job->compare);
+    ssize_t j = begin - i, j_end = end - i_end;
+
+    void** out = job->dst + low + begin;
+    while (i < i_end && j < j_end){
+        // take from the left run on ties to keep the sort stable
+        if (job->compare(right[j], left[i]) < 0) *out++ = right[j++];
+        else *out++ = left[i++];
+    }
+
+    memcpy(out, &left[i], (i_end - i) * sizeof(void*));
+    out += i_end - i;
+    memcpy(out, &right[j], (j_end - j) * sizeof(void*));
+}
+
+int alsort_parallel(array_list *list, thread_pool *pool, int (*compare) (void*, void*)){
+    if (list == NULL || compare == NULL) return -1;
+
+    parallel_job job = make_job(list, pool, NULL);
+
+    // below the grain the threads cost more than they save
+    if (job.chunks == 1) return alsort_stable(list, compare);
+
+    DS_STAT_ADD(list, operations, 1);
+
+    const ds_allocator* allocator = list->allocator;
+    size_t buffer_size = (size_t)list->length * sizeof(void*);
+    size_t bounds_size = (size_t)(job.chunks + 1) * sizeof(ssize_t);
+
+    job.compare = compare;
+    job.buffer = allocator->alloc(allocator->ctx, buffer_size);
+    job.bounds = allocator->alloc(allocator->ctx, bounds_size);
+
+    int success = -1;
+
+    if (job.buffer == NULL || job.bounds == NULL) goto done;
+    if (thread_pool_run(pool, job.chunks, sort_chunk, &job) == -1) goto done;
+
+    job.runs = job.chunks;
+    for (ssize_t chunk = 0; chunk < job.chunks; chunk++){
+        ssize_t end;
+        chunk_bounds(&job, chunk, &job.bounds[chunk], &end);
+    }
+    job.bounds[job.runs] = list->length;
+
+    // merge pairs of runs until one is left, every pass split into about as many pieces as there were chunks
+    job.src = list->arr;
+    job.dst = job.buffer;
+    while (job.runs > 1){
+        ssize_t pairs = (job.runs + 1) / 2;
+        job.parts = (job.chunks / pairs > 0 ? job.chunks / pairs : 1);
+
+        if (thread_pool_run(pool, pairs * job.parts, merge_piece, &job) == -1) goto done;
+
+        for (ssize_t pair = 0; pair < pairs; pair++) job.bounds[pair] = job.bounds[2 * pair];
+        job.bounds[pairs] = list->length;
+        job.runs = pairs;
+
+        void** temp = job.src;
+        job.src = job.dst;
+        job.dst = temp;
+    }
+
+    // an odd number of passes leaves the result in the buffer
+    if (job.src != list->arr) memcpy(list->arr, job.src, buffer_size);
+
+    success = 0;
+
+done:
+    allocator->free(allocator->ctx, job.buffer, buffer_size);
+    allocator->free(allocator->ctx, job.bounds, bounds_size);
+
+    return success;
+}
+
+// ----------------- stats -----------------
+
+int alget_stats(const array_list *list, ds_stats* out){
+    if (out == NULL) return -1;
+
+#ifdef DS_STATS
+    if (list == NULL){
+        *out = (ds_stats){0};
+        return -1;
+    }
+
+    DS_STAT_COPY(list, out);
+
+    return 0;
+#else
+    (void)list;
+    *out = (ds_stats){0};
+
+    return -1;
+#endif
+}
+
+int alreset_stats(array_list *list){
+    if (list == NULL) return -1;
+
+#ifdef DS_STATS
+    DS_STAT_RESET(list, list->length, list->max_size);
+
+    return 0;
+#else
+    return -1;
+#endif
+}
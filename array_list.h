@@ -1,6 +1,19 @@
 #pragma once
 
 #include <sys/types.h>
+#include "ds_stats.h"
+#include "ds_allocator.h"
+
+struct thread_pool;
+
+/**
+ * @brief How an array list grows when it runs out of capacity.
+ */
+typedef enum {
+    AL_GROW_DOUBLE,      /**< Capacity times 2 (the default) */
+    AL_GROW_HALF,        /**< Capacity times 1.5, less slack at the cost of more reallocations */
+    AL_GROW_CHUNK        /**< Capacity plus a fixed number of elements */
+} al_growth_policy;
 
 /**
  * @brief Array list structure.
@@ -9,17 +22,32 @@ typedef struct {
     ssize_t length;      /**< Number of elements currently in the list */
     ssize_t max_size;    /**< Maximum capacity of the array */
     void** arr;          /**< Pointer to the array of element pointers */
+    al_growth_policy growth; /**< Growth policy used when the array is full */
+    ssize_t growth_chunk;    /**< Number of elements added per growth with AL_GROW_CHUNK */
+    ssize_t min_size;        /**< Capacity auto shrink never goes below: the initial capacity, raised by alreserve and lowered by alshrink_to_fit */
+    int auto_shrink;         /**< Non-zero to give memory back as the list empties */
+    const ds_allocator* allocator; /**< Allocator for the struct and the array */
+    DS_STATS_MEMBER          /**< Cost counters, only with DS_STATS (see ds_stats.h) */
 } array_list;
 
 /**
  * @brief Create a new array list with a specified initial size.
  * @param array_size Initial capacity of the array list.
  * @note if the initial size is <=0 the size of the array will be defaulted to 10
- * @note the size of the array doubles when full
+ * @note the size of the array doubles when full, see alset_growth for the other policies
  * @return Pointer to the newly created array list, or NULL on failure.
  */
 array_list* create_array_list(ssize_t array_size);
 
+/**
+ * @brief Create a new array list whose struct and array come from an allocator.
+ * @param array_size Initial capacity of the array list.
+ * @param allocator Allocator to use (NULL for malloc), it must outlive the list.
+ * @note see create_array_list.
+ * @return Pointer to the newly created array list, or NULL on failure.
+ */
+array_list* create_array_list_with(ssize_t array_size, const ds_allocator* allocator);
+
 /**
  * @brief Free the array list and its elements.
  * @param list Pointer to the array list.
@@ -38,6 +66,15 @@ void free_array_list(array_list *list, void (*free_element) (void*));
  */
 ssize_t alget_index(const array_list *list, void* element, int (*compare) (void*, void*));
 
+/**
+ * @brief Get the index of an element by pointer identity.
+ * @param list Pointer to the array list.
+ * @param element Pointer to find, compared by address only.
+ * @note compares several pointers per instruction with SSE2/AVX2 when available instead of calling a compare function per element.
+ * @return Index of the first occurrence, or -1 if not found.
+ */
+ssize_t alfind_ptr(const array_list *list, const void* element);
+
 /**
  * @brief Print all elements in the array list.
  * @param list Pointer to the array list.
@@ -87,6 +124,38 @@ int alappend(array_list *list, void* element);
  */
 int aladd(array_list *list, ssize_t index, void* element);
 
+/**
+ * @brief Append several elements to the end of the array list.
+ * @param list Pointer to the array list.
+ * @param elements Array of element pointers to append (none of them can be NULL).
+ * @param count Number of elements in the array.
+ * @note the capacity is checked once and the elements are copied with a single memcpy. nothing is appended on failure.
+ * @return 0 on success, -1 on failure.
+ */
+int alextend(array_list *list, void** elements, ssize_t count);
+
+/**
+ * @brief Insert several elements at a specific index.
+ * @param list Pointer to the array list.
+ * @param index Index at which to insert the first element.
+ * @param elements Array of element pointers to insert, in order (none of them can be NULL).
+ * @param count Number of elements in the array.
+ * @note the tail is shifted once by count positions. nothing is inserted on failure.
+ * @return 0 on success, -1 on failure.
+ */
+int aladd_range(array_list *list, ssize_t index, void** elements, ssize_t count);
+
+/**
+ * @brief Delete count consecutive elements starting at a specific index.
+ * @param list Pointer to the array list.
+ * @param index Index of the first element to delete.
+ * @param count Number of elements to delete (index + count must not pass the end of the list).
+ * @param free_element Function pointer to free the elements (can be NULL).
+ * @note the tail is shifted once. Memory ownership rules in free_array_list apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int aldelete_range(array_list *list, ssize_t index, ssize_t count, void (*free_element)(void*));
+
 /**
  * @brief Remove the last element from the array list.
  * @param list Pointer to the array list.
@@ -106,3 +175,174 @@ int alpop(array_list *list, void (*free_element)(void*));
  */
 int aldelete(array_list *list, ssize_t index, void (*free_element)(void*));
 
+
+/**
+ * @brief Sort the array list in place (introsort, not stable).
+ * @param list Pointer to the array list.
+ * @param compare Three-way compare function, returns <0, 0 or >0 when the first element orders before, equal to or after the second.
+ * @note O(n log n) worst case: quicksort with median of three pivots, falling back to heapsort when the recursion gets too deep and to insertion sort on small ranges.
+ * @return 0 on success, -1 on failure.
+ */
+int alsort(array_list *list, int (*compare) (void*, void*));
+
+/**
+ * @brief Sort the array list in place, keeping equal elements in their current order (merge sort).
+ * @param list Pointer to the array list.
+ * @param compare Three-way compare function, see alsort.
+ * @note needs a temporary buffer of length / 2 pointers. the list is left untouched if it can't be allocated.
+ * @return 0 on success, -1 on failure.
+ */
+int alsort_stable(array_list *list, int (*compare) (void*, void*));
+
+/**
+ * @brief Find the first position whose element doesn't order before a given element.
+ * @param list Pointer to an array list sorted by compare.
+ * @param element Pointer to the element to look for.
+ * @param compare Three-way compare function, see alsort.
+ * @return Index of the first element >= element (length if there is none), or -1 on failure.
+ */
+ssize_t allower_bound(const array_list *list, void* element, int (*compare) (void*, void*));
+
+/**
+ * @brief Find the first position whose element orders after a given element.
+ * @param list Pointer to an array list sorted by compare.
+ * @param element Pointer to the element to look for.
+ * @param compare Three-way compare function, see alsort.
+ * @return Index of the first element > element (length if there is none), or -1 on failure.
+ */
+ssize_t alupper_bound(const array_list *list, void* element, int (*compare) (void*, void*));
+
+/**
+ * @brief Binary search for an element in a sorted array list.
+ * @param list Pointer to an array list sorted by compare.
+ * @param element Pointer to the element to find.
+ * @param compare Three-way compare function, see alsort.
+ * @note O(log n) replacement for alget_index once the list is sorted. with duplicates the first match is returned.
+ * @return Index of the element, or -1 if not found.
+ */
+ssize_t alsearch_sorted(const array_list *list, void* element, int (*compare) (void*, void*));
+
+/**
+ * @brief Insert an element into a sorted array list, keeping it sorted.
+ * @param list Pointer to an array list sorted by compare.
+ * @param element Pointer to the element to add (can't be NULL).
+ * @param compare Three-way compare function, see alsort.
+ * @note the element goes after the elements equal to it, so repeated inserts keep arrival order.
+ * @return Index the element was inserted at, or -1 on failure.
+ */
+ssize_t aladd_sorted(array_list *list, void* element, int (*compare) (void*, void*));
+
+/**
+ * @brief Choose how the array list grows when it is full.
+ * @param list Pointer to the array list.
+ * @param policy Growth policy.
+ * @param chunk Number of elements added per growth with AL_GROW_CHUNK (must be > 0), ignored by the other policies.
+ * @return 0 on success, -1 on failure.
+ */
+int alset_growth(array_list *list, al_growth_policy policy, ssize_t chunk);
+
+/**
+ * @brief Make sure the array list can hold a number of elements without reallocating.
+ * @param list Pointer to the array list.
+ * @param capacity Number of elements to make room for.
+ * @note the array is resized to exactly capacity when it is smaller, never shrunk. auto shrink keeps at least this capacity from now on.
+ * @return 0 on success, -1 on failure.
+ */
+int alreserve(array_list *list, ssize_t capacity);
+
+/**
+ * @brief Release the unused capacity of the array list.
+ * @param list Pointer to the array list.
+ * @note the capacity becomes the length (at least 1 element), which is also the new floor for auto shrink.
+ * @return 0 on success, -1 on failure.
+ */
+int alshrink_to_fit(array_list *list);
+
+/**
+ * @brief Turn automatic shrinking on or off.
+ * @param list Pointer to the array list.
+ * @param enabled Non-zero to shrink automatically.
+ * @note when enabled, alpop, aldelete and aldelete_range halve the capacity once the list is down to a quarter of it, never going below the initial capacity. growing again only happens once the halved array is full, so alternating pushes and pops around a boundary don't reallocate every time.
+ * @return 0 on success, -1 on failure.
+ */
+int alset_auto_shrink(array_list *list, int enabled);
+
+// ----------------- parallel -----------------
+
+/**
+ * @brief Call a function on every element, spread over a thread pool.
+ * @param list Pointer to the array list.
+ * @param pool Pointer to the thread pool (can be NULL to run serially).
+ * @param fn Function receiving each element, its index and ctx.
+ * @param ctx Context passed to fn (can be NULL).
+ * @note the array is split into contiguous chunks handed to the pool's threads, lists of at most the pool's grain run on the calling thread. fn runs concurrently and in no particular order, it must not add or delete elements.
+ * @return 0 on success, -1 on failure.
+ */
+int alparallel_for(array_list *list, struct thread_pool *pool, void (*fn) (void* element, ssize_t index, void* ctx), void* ctx);
+
+/**
+ * @brief Build a new list holding fn applied to every element, in order, spread over a thread pool.
+ * @param list Pointer to the array list.
+ * @param pool Pointer to the thread pool (can be NULL to run serially).
+ * @param fn Function receiving each element and ctx, returning the new element (can't return NULL).
+ * @param ctx Context passed to fn (can be NULL).
+ * @note the new list uses the same allocator as list and owns nothing by itself: if fn allocates, the caller frees the results. if fn returns NULL for any element the call fails and the other results are not freed.
+ * @return Pointer to the new list, or NULL on failure.
+ */
+array_list* almap(const array_list *list, struct thread_pool *pool, void* (*fn) (void* element, void* ctx), void* ctx);
+
+/**
+ * @brief Build a new list holding the elements for which keep returns non-zero, in their original order, spread over a thread pool.
+ * @param list Pointer to the array list.
+ * @param pool Pointer to the thread pool (can be NULL to run serially).
+ * @param keep Function receiving each element and ctx, returning non-zero to keep it.
+ * @param ctx Context passed to keep (can be NULL).
+ * @note keep is called once per element. every chunk records its decisions, then the kept elements are copied to their final position in a second parallel pass. the new list shares the elements with list.
+ * @return Pointer to the new list, or NULL on failure.
+ */
+array_list* alfilter(const array_list *list, struct thread_pool *pool, int (*keep) (void* element, void* ctx), void* ctx);
+
+/**
+ * @brief Fold every element into an accumulator, spread over a thread pool.
+ * @param list Pointer to the array list.
+ * @param pool Pointer to the thread pool (can be NULL to run serially).
+ * @param acc Pointer to acc_size bytes holding the initial value, receiving the result.
+ * @param acc_size Size of the accumulator in bytes.
+ * @param accumulate Function adding an element to a chunk's accumulator.
+ * @param combine Function adding a chunk's accumulator (partial) to acc.
+ * @param ctx Context passed to accumulate and combine (can be NULL).
+ * @note every chunk starts from a copy of the initial value of acc, so it must be an identity of combine (0 for a sum, 1 for a product, ...). the partial results are combined in chunk order, so combine only needs to be associative, not commutative.
+ * @return 0 on success, -1 on failure.
+ */
+int alreduce(const array_list *list, struct thread_pool *pool, void* acc, size_t acc_size,
+             void (*accumulate) (void* acc, void* element, void* ctx),
+             void (*combine) (void* acc, const void* partial, void* ctx), void* ctx);
+
+/**
+ * @brief Sort the array list in place, keeping equal elements in their current order, spread over a thread pool (merge sort).
+ * @param list Pointer to the array list.
+ * @param pool Pointer to the thread pool (can be NULL to run serially).
+ * @param compare Three-way compare function, see alsort. called concurrently, it must not modify shared state.
+ * @note every chunk is sorted by its own thread, then pairs of sorted runs are merged pass after pass. each merge is split at binary searched points so all the threads keep working until the last pass. lists of at most the pool's grain fall back to alsort_stable. needs a temporary buffer of length pointers, the list is left untouched if it can't be allocated.
+ * @return 0 on success, -1 on failure.
+ */
+int alsort_parallel(array_list *list, struct thread_pool *pool, int (*compare) (void*, void*));
+
+// ----------------- stats -----------------
+
+/**
+ * @brief Copy out the cost counters of the list.
+ * @param list Pointer to the array list.
+ * @param out Pointer receiving the counters.
+ * @note only available when the library is built with DS_STATS, see ds_stats.h.
+ * @return 0 on success, -1 on failure or when the counters are compiled out (out is zeroed then).
+ */
+int alget_stats(const array_list *list, ds_stats* out);
+
+/**
+ * @brief Reset the cost counters of the list.
+ * @param list Pointer to the array list.
+ * @note the peaks restart from the current length and capacity.
+ * @return 0 on success, -1 on failure or when the counters are compiled out.
+ */
+int alreset_stats(array_list *list);
@@ -0,0 +1,558 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/types.h>
+#include <sys/resource.h>
+#include "../array_list.h"
+#include "../linked_list.h"
+#include "../queue.h"
+#include "../stack.h"
+#include "../value_list.h"
+#include "../simd_search.h"
+#include "../gap_list.h"
+#include "../deque.h"
+#include "../thread_pool.h"
+#include "../skip_list.h"
+
+// Microbenchmarks for every container, one line per (operation, size).
+//
+// usage: bench [--json] [--max-size N]
+//
+// Sizes go from 1e2 to --max-size (default 1e7) by powers of ten. For each size the container is
+// prefilled with `size` elements where the operation needs it, then the operation runs `ops` times.
+// Operations that cost O(size) each (front/middle inserts, index searches, ...) run fewer times on big
+// lists so every line stays within a fixed amount of work. peak_rss_kb is the process high-water mark
+// after the line ran, so it only ever grows over a run.
+
+#define MIN_SIZE 100L
+#define DEFAULT_MAX_SIZE 10000000L
+// element visits (or moved pointers) allowed per line for the O(size) operations
+#define WORK_BUDGET 200000000L
+
+static int json_output = 0;
+static volatile long sink;
+
+typedef struct {
+    ssize_t size;
+    ssize_t ops;
+    int* values;    // backing storage for the elements, no malloc per element
+} bench_ctx;
+
+static double now_seconds(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static long peak_rss_kb(void) {
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+static void report(const char* op, const bench_ctx* ctx, double seconds) {
+    double ns_per_op = seconds * 1e9 / (double)ctx->ops;
+    double ops_per_s = (double)ctx->ops / seconds;
+
+    if (json_output)
+        printf("{\"op\":\"%s\",\"size\":%zd,\"ops\":%zd,\"seconds\":%.6f,\"ns_per_op\":%.2f,\"ops_per_s\":%.0f,\"peak_rss_kb\":%ld}\n",
+               op, ctx->size, ctx->ops, seconds, ns_per_op, ops_per_s, peak_rss_kb());
+    else
+        printf("%s,%zd,%zd,%.6f,%.2f,%.0f,%ld\n", op, ctx->size, ctx->ops, seconds, ns_per_op, ops_per_s, peak_rss_kb());
+    fflush(stdout);
+}
+
+// number of repetitions for an operation costing `per_op` element visits
+static ssize_t budgeted_ops(ssize_t size, ssize_t per_op) {
+    ssize_t ops = WORK_BUDGET / (per_op > 0 ? per_op : 1);
+    if (ops > size) ops = size;
+    return (ops < 1 ? 1 : ops);
+}
+
+// i-th lookup target, spread over the whole list even when only a few lookups run
+static ssize_t spread(ssize_t i, ssize_t size) {
+    return (ssize_t)(((unsigned long long)i * 2654435761ULL) % (unsigned long long)size);
+}
+
+static int compare_int(void* a, void* b) {
+    return (*(int*)a == *(int*)b) ? 0 : -1;
+}
+
+static array_list* filled_array_list(const bench_ctx* ctx) {
+    array_list* list = create_array_list(ctx->size);
+    for (ssize_t i = 0; i < ctx->size; ++i) alappend(list, &ctx->values[i]);
+    return list;
+}
+
+static linked_list* filled_linked_list(const bench_ctx* ctx) {
+    linked_list* list = create_linked_list();
+    for (ssize_t i = 0; i < ctx->size; ++i) llappend(list, &ctx->values[i]);
+    return list;
+}
+
+// ----------------- array_list -----------------
+
+static void bench_alappend(bench_ctx* ctx) {
+    array_list* list = create_array_list(0);
+    ctx->ops = ctx->size;
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) alappend(list, &ctx->values[i]);
+    report("alappend", ctx, now_seconds() - start);
+
+    free_array_list(list, NULL);
+}
+
+static void bench_aladd(bench_ctx* ctx, const char* op, int where) {
+    array_list* list = filled_array_list(ctx);
+    ctx->ops = budgeted_ops(ctx->size, where == 2 ? 1 : (where == 1 ? ctx->size / 2 : ctx->size));
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) {
+        ssize_t index = (where == 0 ? 0 : (where == 1 ? list->length / 2 : list->length));
+        aladd(list, index, &ctx->values[i]);
+    }
+    report(op, ctx, now_seconds() - start);
+
+    free_array_list(list, NULL);
+}
+
+static void bench_aldelete(bench_ctx* ctx, const char* op, int front) {
+    array_list* list = filled_array_list(ctx);
+    ctx->ops = (front ? budgeted_ops(ctx->size, ctx->size) : ctx->size);
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) aldelete(list, front ? 0 : list->length - 1, NULL);
+    report(op, ctx, now_seconds() - start);
+
+    free_array_list(list, NULL);
+}
+
+static void bench_alget_index(bench_ctx* ctx) {
+    array_list* list = filled_array_list(ctx);
+    ctx->ops = budgeted_ops(ctx->size, ctx->size / 2);
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) {
+        // half a scan on average
+        int target = (int)spread(i, ctx->size);
+        sink += alget_index(list, &target, compare_int);
+    }
+    report("alget_index", ctx, now_seconds() - start);
+
+    free_array_list(list, NULL);
+}
+
+static int order_int(void* a, void* b) {
+    int ia = *(int*)a, ib = *(int*)b;
+    return (ia > ib) - (ia < ib);
+}
+
+// pool is only used (and required) by the parallel sort
+static void bench_alsort(bench_ctx* ctx, const char* op, int stable, thread_pool* pool) {
+    array_list* list = filled_array_list(ctx);
+    ctx->ops = ctx->size;
+
+    // scramble the prefill so the sort has work to do, ops counts sorted elements
+    unsigned long long state = 88172645463325252ULL;
+    for (ssize_t i = ctx->size - 1; i > 0; --i) {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        ssize_t j = (ssize_t)(state % (unsigned long long)(i + 1));
+        void* temp = list->arr[i];
+        list->arr[i] = list->arr[j];
+        list->arr[j] = temp;
+    }
+
+    double start = now_seconds();
+    if (pool != NULL) alsort_parallel(list, pool, order_int);
+    else if (stable) alsort_stable(list, order_int);
+    else alsort(list, order_int);
+    report(op, ctx, now_seconds() - start);
+
+    free_array_list(list, NULL);
+}
+
+static void bench_alsearch_sorted(bench_ctx* ctx) {
+    array_list* list = filled_array_list(ctx);
+    ctx->ops = ctx->size;
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) {
+        int target = (int)spread(i, ctx->size);
+        sink += alsearch_sorted(list, &target, order_int);
+    }
+    report("alsearch_sorted", ctx, now_seconds() - start);
+
+    free_array_list(list, NULL);
+}
+
+static int compare_ptr(void* a, void* b) {
+    return (a == b) ? 0 : -1;
+}
+
+// identity search, callback loop against the vectorized scan
+static void bench_alfind_ptr(bench_ctx* ctx) {
+    array_list* list = filled_array_list(ctx);
+    ctx->ops = budgeted_ops(ctx->size, ctx->size / 2);
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i)
+        sink += alget_index(list, &ctx->values[spread(i, ctx->size)], compare_ptr);
+    report("alget_index_ptr", ctx, now_seconds() - start);
+
+    start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i)
+        sink += alfind_ptr(list, &ctx->values[spread(i, ctx->size)]);
+    report("alfind_ptr", ctx, now_seconds() - start);
+
+    free_array_list(list, NULL);
+}
+
+static int compare_int32(void* a, void* b) {
+    return (*(int32_t*)a == *(int32_t*)b) ? 0 : -1;
+}
+
+// key search over inline int32 values, callback loop against the vectorized scan
+static void bench_vlfind_int32(bench_ctx* ctx) {
+    value_list* list = create_value_list(sizeof(int32_t), ctx->size);
+    for (ssize_t i = 0; i < ctx->size; ++i) vlappend(list, &ctx->values[i]);
+    ctx->ops = budgeted_ops(ctx->size, ctx->size / 2);
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) {
+        int32_t target = (int32_t)spread(i, ctx->size);
+        sink += vlget_index(list, &target, compare_int32);
+    }
+    report("vlget_index_int32", ctx, now_seconds() - start);
+
+    start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) sink += vlfind_int32(list, (int32_t)spread(i, ctx->size));
+    report("vlfind_int32", ctx, now_seconds() - start);
+
+    free_value_list(list, NULL);
+}
+
+static void sum_element(void* acc, void* element, void* ctx) {
+    (void)ctx;
+    *(long*)acc += *(int*)element;
+}
+
+static void combine_sum(void* acc, const void* partial, void* ctx) {
+    (void)ctx;
+    *(long*)acc += *(const long*)partial;
+}
+
+static int keep_even(void* element, void* ctx) {
+    (void)ctx;
+    return (*(int*)element & 1) == 0;
+}
+
+// one pass over the whole list per op, without a pool (serial) and over every CPU
+static void bench_alparallel(bench_ctx* ctx, thread_pool* pool, const char* reduce_op, const char* filter_op) {
+    array_list* list = create_array_list(ctx->size);
+    for (ssize_t i = 0; i < ctx->size; ++i) alappend(list, &ctx->values[i]);
+    ctx->ops = budgeted_ops(ctx->size, ctx->size);
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) {
+        long sum = 0;
+        alreduce(list, pool, &sum, sizeof(long), sum_element, combine_sum, NULL);
+        sink += sum;
+    }
+    report(reduce_op, ctx, now_seconds() - start);
+
+    start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) {
+        array_list* kept = alfilter(list, pool, keep_even, NULL);
+        sink += kept->length;
+        free_array_list(kept, NULL);
+    }
+    report(filter_op, ctx, now_seconds() - start);
+
+    free_array_list(list, NULL);
+}
+
+// ----------------- gap_list -----------------
+
+// same insert positions as aladd_middle, the gap stays where the inserts happen
+static void bench_gladd_middle(bench_ctx* ctx) {
+    gap_list* list = create_gap_list(ctx->size);
+    for (ssize_t i = 0; i < ctx->size; ++i) glappend(list, &ctx->values[i]);
+    ctx->ops = ctx->size;
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) gladd(list, list->length / 2, &ctx->values[i]);
+    report("gladd_middle", ctx, now_seconds() - start);
+
+    start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) sink += *(int*)glget(list, spread(i, list->length));
+    report("glget", ctx, now_seconds() - start);
+
+    free_gap_list(list, NULL);
+}
+
+// ----------------- linked_list -----------------
+
+static void bench_lladd(bench_ctx* ctx, const char* op, int middle) {
+    linked_list* list = filled_linked_list(ctx);
+    ctx->ops = (middle ? budgeted_ops(ctx->size, ctx->size / 2) : ctx->size);
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) lladd(list, middle ? list->length / 2 : 0, &ctx->values[i]);
+    report(op, ctx, now_seconds() - start);
+
+    free_linked_list(list, NULL);
+}
+
+static void bench_llpop(bench_ctx* ctx) {
+    linked_list* list = filled_linked_list(ctx);
+    ctx->ops = ctx->size;
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) llpop(list, NULL);
+    report("llpop", ctx, now_seconds() - start);
+
+    free_linked_list(list, NULL);
+}
+
+static void bench_llget(bench_ctx* ctx) {
+    linked_list* list = filled_linked_list(ctx);
+    ctx->ops = budgeted_ops(ctx->size, ctx->size / 4);
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) sink += *(int*)llget(list, spread(i, ctx->size));
+    report("llget", ctx, now_seconds() - start);
+
+    free_linked_list(list, NULL);
+}
+
+static void bench_llcursor_scan(bench_ctx* ctx) {
+    linked_list* list = filled_linked_list(ctx);
+    ctx->ops = ctx->size;
+
+    double start = now_seconds();
+    for (ll_cursor cursor = llcursor_begin(list); llcursor_valid(&cursor); llcursor_next(&cursor))
+        sink += *(int*)llcursor_get(&cursor);
+    report("llcursor_scan", ctx, now_seconds() - start);
+
+    free_linked_list(list, NULL);
+}
+
+// ----------------- skip_list -----------------
+
+static skip_list* filled_skip_list(const bench_ctx* ctx) {
+    skip_list* list = create_skip_list();
+    for (ssize_t i = 0; i < ctx->size; ++i) slappend(list, &ctx->values[i]);
+    return list;
+}
+
+// random positions, the workload the lanes are for
+static void bench_sladd_random(bench_ctx* ctx) {
+    skip_list* list = filled_skip_list(ctx);
+    ctx->ops = ctx->size;
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) sladd(list, spread(i, list->length + 1), &ctx->values[i]);
+    report("sladd_random", ctx, now_seconds() - start);
+
+    free_skip_list(list, NULL);
+}
+
+static void bench_slget(bench_ctx* ctx) {
+    skip_list* list = filled_skip_list(ctx);
+    ctx->ops = ctx->size;
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) sink += *(int*)slget(list, spread(i, ctx->size));
+    report("slget", ctx, now_seconds() - start);
+
+    free_skip_list(list, NULL);
+}
+
+static void bench_sldelete_random(bench_ctx* ctx) {
+    skip_list* list = filled_skip_list(ctx);
+    ctx->ops = ctx->size;
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) sldelete(list, spread(i, list->length), NULL);
+    report("sldelete_random", ctx, now_seconds() - start);
+
+    free_skip_list(list, NULL);
+}
+
+// ----------------- queue -----------------
+
+static void bench_queue(bench_ctx* ctx, queue_backend backend, const char* enqueue_op, const char* dequeue_op) {
+    queue* qu = create_queue_backend(backend, 0);
+    ctx->ops = ctx->size;
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) enqueue(qu, &ctx->values[i]);
+    report(enqueue_op, ctx, now_seconds() - start);
+
+    start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) sink += *(int*)dequeue(qu);
+    report(dequeue_op, ctx, now_seconds() - start);
+
+    free_queue(qu, NULL);
+}
+
+// values[i] == i, so a spilled element is its value and comes back as a pointer into values
+static int* spill_values;
+
+static ssize_t serialize_value(void* element, void* buffer, size_t capacity) {
+    if (capacity >= sizeof(int)) memcpy(buffer, element, sizeof(int));
+    return sizeof(int);
+}
+
+static void* deserialize_value(const void* buffer, size_t size) {
+    (void)size;
+    int v;
+    memcpy(&v, buffer, sizeof(int));
+    return &spill_values[v];
+}
+
+// everything past a 4096 element budget goes through the segment files and back
+static void bench_queue_spilling(bench_ctx* ctx) {
+    queue_spill_config config = {4096, NULL, 0, serialize_value, deserialize_value, NULL};
+    queue* qu = create_spilling_queue(&config);
+    spill_values = ctx->values;
+    ctx->ops = ctx->size;
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) enqueue(qu, &ctx->values[i]);
+    report("enqueue_spilling", ctx, now_seconds() - start);
+
+    start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) sink += *(int*)dequeue(qu);
+    report("dequeue_spilling", ctx, now_seconds() - start);
+
+    free_queue(qu, NULL);
+}
+
+// ----------------- deque -----------------
+
+// the front end, which costs aladd_front on an array_list and is O(1) here
+static void bench_deque_front(bench_ctx* ctx) {
+    deque* dq = create_deque(0);
+    ctx->ops = ctx->size;
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) dqpush_front(dq, &ctx->values[i]);
+    report("dqpush_front", ctx, now_seconds() - start);
+
+    start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) sink += *(int*)dqget(dq, spread(i, ctx->size));
+    report("dqget", ctx, now_seconds() - start);
+
+    start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) sink += *(int*)dqpop_back(dq);
+    report("dqpop_back", ctx, now_seconds() - start);
+
+    free_deque(dq, NULL);
+}
+
+// ----------------- stack -----------------
+
+static void bench_stack(bench_ctx* ctx) {
+    stack* st = create_stack(0);
+    ctx->ops = ctx->size;
+
+    double start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) stack_push(st, &ctx->values[i]);
+    report("stack_push", ctx, now_seconds() - start);
+
+    start = now_seconds();
+    for (ssize_t i = 0; i < ctx->ops; ++i) sink += *(int*)stack_pop(st);
+    report("stack_pop", ctx, now_seconds() - start);
+
+    free_stack(st, NULL);
+}
+
+int main(int argc, char** argv) {
+    long max_size = DEFAULT_MAX_SIZE;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "--json") == 0) json_output = 1;
+        else if (strcmp(argv[i], "--max-size") == 0 && i + 1 < argc) max_size = atol(argv[++i]);
+        else {
+            fprintf(stderr, "usage: %s [--json] [--max-size N]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    static const char* simd_levels[] = {"scalar", "sse2", "avx2"};
+    fprintf(stderr, "search kernels: %s\n", simd_levels[simd_search_active_level()]);
+
+    thread_pool* pool = create_thread_pool(0);
+    if (pool == NULL) return 1;
+    fprintf(stderr, "parallel threads: %zd\n", pool->thread_count);
+
+    // the parallel sort is timed on 1, 2, 4, ... threads, up to 64 and the CPUs available
+    thread_pool* sort_pools[7];
+    int sort_pool_count = 0;
+    for (ssize_t threads = 1; threads <= 64 && threads <= pool->thread_count; threads *= 2) {
+        sort_pools[sort_pool_count] = create_thread_pool(threads);
+        if (sort_pools[sort_pool_count] == NULL) return 1;
+        sort_pool_count++;
+    }
+
+    if (!json_output) printf("op,size,ops,seconds,ns_per_op,ops_per_s,peak_rss_kb\n");
+
+    for (long size = MIN_SIZE; size <= max_size; size *= 10) {
+        bench_ctx ctx = { .size = size, .ops = 0 };
+        // inserts may add up to `size` more elements on top of the prefill
+        ctx.values = malloc(sizeof(int) * (size_t)size * 2);
+        if (ctx.values == NULL) return 1;
+        for (long i = 0; i < size * 2; ++i) ctx.values[i] = (int)i;
+
+        bench_alappend(&ctx);
+        bench_aladd(&ctx, "aladd_front", 0);
+        bench_aladd(&ctx, "aladd_middle", 1);
+        bench_aladd(&ctx, "aladd_end", 2);
+        bench_aldelete(&ctx, "aldelete_front", 1);
+        bench_aldelete(&ctx, "aldelete_end", 0);
+        bench_alget_index(&ctx);
+        bench_alsort(&ctx, "alsort", 0, NULL);
+        bench_alsort(&ctx, "alsort_stable", 1, NULL);
+        for (int i = 0; i < sort_pool_count; ++i) {
+            char op[32];
+            snprintf(op, sizeof(op), "alsort_parallel_%zdt", sort_pools[i]->thread_count);
+            bench_alsort(&ctx, op, 1, sort_pools[i]);
+        }
+        bench_alsearch_sorted(&ctx);
+        bench_alfind_ptr(&ctx);
+        bench_vlfind_int32(&ctx);
+        bench_alparallel(&ctx, NULL, "alreduce_serial", "alfilter_serial");
+        bench_alparallel(&ctx, pool, "alreduce_parallel", "alfilter_parallel");
+
+        bench_gladd_middle(&ctx);
+
+        bench_lladd(&ctx, "lladd_front", 0);
+        bench_lladd(&ctx, "lladd_middle", 1);
+        bench_llpop(&ctx);
+        bench_llget(&ctx);
+        bench_llcursor_scan(&ctx);
+
+        bench_sladd_random(&ctx);
+        bench_slget(&ctx);
+        bench_sldelete_random(&ctx);
+
+        bench_queue(&ctx, QUEUE_LINKED_LIST, "enqueue_linked", "dequeue_linked");
+        bench_queue(&ctx, QUEUE_RING_BUFFER, "enqueue_ring", "dequeue_ring");
+        bench_queue_spilling(&ctx);
+
+        bench_deque_front(&ctx);
+        bench_stack(&ctx);
+
+        free(ctx.values);
+    }
+
+    free_thread_pool(pool);
+    for (int i = 0; i < sort_pool_count; ++i) free_thread_pool(sort_pools[i]);
+
+    return 0;
+}
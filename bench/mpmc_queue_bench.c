@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <pthread.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#include "../mpmc_queue.h"
+#include "../queue.h"
+
+// Contention benchmark: mpmc_queue against a mutex-wrapped queue, from 1 thread up to every core.
+// Each run splits the threads between producers and consumers and moves the same total number of elements.
+// Output is one CSV line per (implementation, threads) pair.
+
+#define TOTAL_OPS (1L << 22)
+
+#define TO_ELEMENT(i) ((void*)(uintptr_t)((i) + 1))
+
+typedef struct {
+    pthread_mutex_t lock;
+    queue* qu;
+} locked_queue;
+
+typedef struct {
+    int locked;
+    mpmc_queue* mpmc;
+    locked_queue* lq;
+    long ops;
+} bench_arg;
+
+static void locked_enqueue(locked_queue* lq, void* element) {
+    pthread_mutex_lock(&lq->lock);
+    enqueue(lq->qu, element);
+    pthread_mutex_unlock(&lq->lock);
+}
+
+static void* locked_dequeue(locked_queue* lq) {
+    void* val;
+    // spin like mpmc_dequeue does, so both sides wait the same way on an empty queue
+    for (;;) {
+        pthread_mutex_lock(&lq->lock);
+        val = dequeue(lq->qu);
+        pthread_mutex_unlock(&lq->lock);
+        if (val != NULL) return val;
+        sched_yield();
+    }
+}
+
+static void* producer(void* p) {
+    bench_arg* arg = p;
+    for (long i = 0; i < arg->ops; ++i) {
+        if (arg->locked) locked_enqueue(arg->lq, TO_ELEMENT(i));
+        else mpmc_enqueue(arg->mpmc, TO_ELEMENT(i));
+    }
+    return NULL;
+}
+
+static void* consumer(void* p) {
+    bench_arg* arg = p;
+    for (long i = 0; i < arg->ops; ++i) {
+        if (arg->locked) locked_dequeue(arg->lq);
+        else mpmc_dequeue(arg->mpmc);
+    }
+    return NULL;
+}
+
+// a single thread alternates enqueue and dequeue so the 1-thread point is still measurable
+static void* solo(void* p) {
+    bench_arg* arg = p;
+    for (long i = 0; i < arg->ops; ++i) {
+        if (arg->locked) {
+            locked_enqueue(arg->lq, TO_ELEMENT(i));
+            locked_dequeue(arg->lq);
+        } else {
+            mpmc_enqueue(arg->mpmc, TO_ELEMENT(i));
+            mpmc_dequeue(arg->mpmc);
+        }
+    }
+    return NULL;
+}
+
+static double run(int locked, int threads) {
+    mpmc_queue* mpmc = create_mpmc_queue(4096);
+    locked_queue lq;
+    pthread_mutex_init(&lq.lock, NULL);
+    lq.qu = create_queue_backend(QUEUE_RING_BUFFER, 4096);
+
+    int producers = (threads > 1 ? threads / 2 : 1);
+    int consumers = (threads > 1 ? threads - producers : 0);
+    pthread_t* ids = malloc(sizeof(pthread_t) * threads);
+    bench_arg* args = malloc(sizeof(bench_arg) * threads);
+    struct timespec start, end;
+    // consumers never take more than the producers put in, so nobody waits forever
+    long per_producer = TOTAL_OPS / producers;
+    long per_consumer = (consumers > 0 ? per_producer * producers / consumers : 0);
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < threads; ++i) {
+        args[i].locked = locked;
+        args[i].mpmc = mpmc;
+        args[i].lq = &lq;
+        args[i].ops = (i < producers ? per_producer : per_consumer);
+        void* (*fn)(void*) = (threads == 1 ? solo : (i < producers ? producer : consumer));
+        pthread_create(&ids[i], NULL, fn, &args[i]);
+    }
+    for (int i = 0; i < threads; ++i) pthread_join(ids[i], NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    free(ids);
+    free(args);
+    free_mpmc_queue(mpmc, NULL);
+    free_queue(lq.qu, NULL);
+    pthread_mutex_destroy(&lq.lock);
+
+    return (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+int main(int argc, char** argv) {
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    int max_threads = (argc > 1 ? atoi(argv[1]) : (int)cores);
+    if (max_threads < 1) max_threads = 1;
+
+    // thread counts double from 1 and always end on max_threads even when it is not a power of two
+    printf("impl,threads,ops,seconds,ns_per_op,mops_per_s\n");
+    for (int threads = 1; threads <= max_threads; threads = (threads < max_threads && threads * 2 > max_threads ? max_threads : threads * 2)) {
+        for (int locked = 0; locked <= 1; ++locked) {
+            double seconds = run(locked, threads);
+            printf("%s,%d,%ld,%.6f,%.2f,%.2f\n", locked ? "mutex_queue" : "mpmc_queue", threads, TOTAL_OPS,
+                   seconds, seconds * 1e9 / TOTAL_OPS, TOTAL_OPS / seconds / 1e6);
+        }
+    }
+
+    return 0;
+}
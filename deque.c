@@ -0,0 +1,279 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/types.h>
+#include "deque.h"
+
+// ring index of the element at index, wrapping with a mask since the capacity is a power of two
+#define SLOT(dq, index) (((dq)->head + (index)) & ((dq)->capacity - 1))
+
+deque* create_deque(ssize_t init_size){
+    return create_deque_with(init_size, NULL);
+}
+
+deque* create_deque_with(ssize_t init_size, const ds_allocator* allocator){
+    if (allocator == NULL) allocator = ds_default_allocator();
+
+    // round the hint up to a power of two so wrapping is a mask instead of a modulo
+    ssize_t capacity = 16;
+    if (init_size > 0){
+        if ((size_t)init_size > SIZE_MAX / 2 / sizeof(void*)) return NULL;
+        capacity = 1;
+        while (capacity < init_size) capacity *= 2;
+    }
+
+    deque* dq = allocator->alloc(allocator->ctx, sizeof(deque));
+
+    if (dq == NULL) return NULL;
+
+    dq->ring = allocator->alloc(allocator->ctx, sizeof(void*) * capacity);
+
+    if (dq->ring == NULL){
+        allocator->free(allocator->ctx, dq, sizeof(deque));
+        return NULL;
+    }
+
+    dq->head = 0;
+    dq->length = 0;
+    dq->capacity = capacity;
+    dq->allocator = allocator;
+    DS_STAT_RESET(dq, 0, capacity);
+
+    return dq;
+}
+
+int free_deque(deque *dq, void (*free_element) (void*)){
+    if (dq == NULL) return -1;
+
+    if (free_element != NULL)
+        for (ssize_t i = 0; i < dq->length; i++)
+            free_element(dq->ring[SLOT(dq, i)]);
+
+    const ds_allocator* allocator = dq->allocator;
+
+    allocator->free(allocator->ctx, dq->ring, dq->capacity * sizeof(void*));
+    allocator->free(allocator->ctx, dq, sizeof(deque));
+
+    return 0;
+}
+
+// grow the ring (doubling) until it can hold needed elements
+static int reserve_ring(deque* dq, ssize_t needed){
+    if (needed <= dq->capacity) return 0;
+
+    ssize_t new_capacity = dq->capacity;
+    while (new_capacity < needed){
+        if ((size_t)new_capacity > SIZE_MAX / 2 / sizeof(void*)) return -1;
+        new_capacity *= 2;
+    }
+
+    const ds_allocator* allocator = dq->allocator;
+    void** new_ring = allocator->alloc(allocator->ctx, sizeof(void*) * new_capacity);
+    if (new_ring == NULL) return -1;
+
+    // unwrap the ring so the front element lands at index 0
+    ssize_t first_part = dq->capacity - dq->head;
+    if (first_part > dq->length) first_part = dq->length;
+    memcpy(new_ring, &dq->ring[dq->head], first_part * sizeof(void*));
+    memcpy(&new_ring[first_part], dq->ring, (dq->length - first_part) * sizeof(void*));
+
+    allocator->free(allocator->ctx, dq->ring, dq->capacity * sizeof(void*));
+    dq->ring = new_ring;
+    dq->head = 0;
+    dq->capacity = new_capacity;
+    DS_STAT_ADD(dq, reallocations, 1);
+    DS_STAT_ADD(dq, bytes_moved, dq->length * sizeof(void*));
+    DS_STAT_PEAK(dq, peak_capacity, new_capacity);
+
+    return 0;
+}
+
+int dqpush_front(deque *dq, void* element){
+    if (dq == NULL || element == NULL) return -1;
+    if (dq->length == dq->capacity)
+        if (reserve_ring(dq, dq->length + 1) == -1) return -1;
+
+    dq->head = (dq->head - 1) & (dq->capacity - 1);
+    dq->ring[dq->head] = element;
+    dq->length++;
+    DS_STAT_ADD(dq, operations, 1);
+    DS_STAT_PEAK(dq, peak_length, dq->length);
+
+    return 0;
+}
+
+int dqpush_back(deque *dq, void* element){
+    if (dq == NULL || element == NULL) return -1;
+    if (dq->length == dq->capacity)
+        if (reserve_ring(dq, dq->length + 1) == -1) return -1;
+
+    dq->ring[SLOT(dq, dq->length)] = element;
+    dq->length++;
+    DS_STAT_ADD(dq, operations, 1);
+    DS_STAT_PEAK(dq, peak_length, dq->length);
+
+    return 0;
+}
+
+void* dqpop_front(deque *dq){
+    if (dq == NULL || dq->length == 0) return NULL;
+
+    void* val = dq->ring[dq->head];
+    dq->head = (dq->head + 1) & (dq->capacity - 1);
+    dq->length--;
+    DS_STAT_ADD(dq, operations, 1);
+
+    return val;
+}
+
+void* dqpop_back(deque *dq){
+    if (dq == NULL || dq->length == 0) return NULL;
+
+    dq->length--;
+    DS_STAT_ADD(dq, operations, 1);
+
+    return dq->ring[SLOT(dq, dq->length)];
+}
+
+int dqpush_back_many(deque *dq, void** elements, ssize_t count){
+    if (dq == NULL || elements == NULL || count < 0) return -1;
+
+    for (ssize_t i = 0; i < count; i++)
+        if (elements[i] == NULL) return -1;
+
+    if ((size_t)count > SIZE_MAX / sizeof(void*) - (size_t)dq->length) return -1;
+    if (reserve_ring(dq, dq->length + count) == -1) return -1;
+
+    // the batch lands in at most two contiguous runs of the ring
+    ssize_t tail = SLOT(dq, dq->length);
+    ssize_t first_part = dq->capacity - tail;
+    if (first_part > count) first_part = count;
+
+    memcpy(&dq->ring[tail], elements, first_part * sizeof(void*));
+    memcpy(dq->ring, &elements[first_part], (count - first_part) * sizeof(void*));
+    dq->length += count;
+    DS_STAT_ADD(dq, operations, 1);
+    DS_STAT_ADD(dq, bytes_moved, count * sizeof(void*));
+    DS_STAT_PEAK(dq, peak_length, dq->length);
+
+    return 0;
+}
+
+ssize_t dqpop_front_many(deque *dq, void** out, ssize_t max_count){
+    if (dq == NULL || out == NULL || max_count < 0) return -1;
+
+    ssize_t n = (dq->length < max_count ? dq->length : max_count);
+    ssize_t first_part = dq->capacity - dq->head;
+    if (first_part > n) first_part = n;
+
+    memcpy(out, &dq->ring[dq->head], first_part * sizeof(void*));
+    memcpy(&out[first_part], dq->ring, (n - first_part) * sizeof(void*));
+    dq->head = (dq->head + n) & (dq->capacity - 1);
+    dq->length -= n;
+    DS_STAT_ADD(dq, operations, 1);
+    DS_STAT_ADD(dq, bytes_moved, n * sizeof(void*));
+
+    return n;
+}
+
+void* dqfront(const deque *dq){
+    if (dq == NULL || dq->length == 0) return NULL;
+
+    return dq->ring[dq->head];
+}
+
+void* dqback(const deque *dq){
+    if (dq == NULL || dq->length == 0) return NULL;
+
+    return dq->ring[SLOT(dq, dq->length - 1)];
+}
+
+void* dqget(const deque *dq, ssize_t index){
+    if (dq == NULL || index < 0 || index >= dq->length) return NULL;
+
+    DS_STAT_ADD(dq, operations, 1);
+
+    return dq->ring[SLOT(dq, index)];
+}
+
+int dqset(deque *dq, ssize_t index, void* element, void (*free_element) (void*)){
+    if (dq == NULL || element == NULL || index < 0 || index >= dq->length) return -1;
+
+    DS_STAT_ADD(dq, operations, 1);
+
+    void** slot = &dq->ring[SLOT(dq, index)];
+
+    if (free_element != NULL) free_element(*slot);
+
+    *slot = element;
+
+    return 0;
+}
+
+ssize_t dqget_index(const deque *dq, void* element, int (*compare) (void*, void*)){
+    if (dq == NULL || element == NULL || compare == NULL) return -1;
+
+    DS_STAT_ADD(dq, operations, 1);
+
+    for (ssize_t i = 0; i < dq->length; i++){
+        if (compare(dq->ring[SLOT(dq, i)], element) == 0){
+            DS_STAT_ADD(dq, traversal_steps, i + 1);
+            return i;
+        }
+    }
+
+    DS_STAT_ADD(dq, traversal_steps, dq->length);
+
+    return -1;
+}
+
+void dqprint(const deque *dq, void (*print_element) (void*)){
+    if (dq == NULL || dq->length == 0 || print_element == NULL) {
+        printf("[]\n");
+        return;
+    }
+
+    printf("[");
+
+    for (ssize_t i = 0; i < dq->length; i++){
+        print_element(dq->ring[SLOT(dq, i)]);
+        printf(", ");
+    }
+
+    printf("\b\b]\n");
+}
+
+// ----------------- stats -----------------
+
+int dqget_stats(const deque *dq, ds_stats* out){
+    if (out == NULL) return -1;
+
+#ifdef DS_STATS
+    if (dq == NULL){
+        *out = (ds_stats){0};
+        return -1;
+    }
+
+    DS_STAT_COPY(dq, out);
+
+    return 0;
+#else
+    (void)dq;
+    *out = (ds_stats){0};
+
+    return -1;
+#endif
+}
+
+int dqreset_stats(deque *dq){
+    if (dq == NULL) return -1;
+
+#ifdef DS_STATS
+    DS_STAT_RESET(dq, dq->length, dq->capacity);
+
+    return 0;
+#else
+    return -1;
+#endif
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <sys/types.h>
+#include "ds_stats.h"
+#include "ds_allocator.h"
+
+/**
+ * @brief Double-ended queue stored in a growable circular array.
+ * @note pushes and pops at both ends are O(1) amortized and indexed access is O(1). the elements wrap around the end of the array, so they are contiguous in at most two runs.
+ */
+typedef struct {
+    void** ring;         /**< Circular array of element pointers */
+    ssize_t head;        /**< Index in the ring of the front element */
+    ssize_t length;      /**< Number of elements in the deque */
+    ssize_t capacity;    /**< Capacity of the ring, always a power of two */
+    const ds_allocator* allocator; /**< Allocator for the struct and the ring */
+    DS_STATS_MEMBER      /**< Cost counters, only with DS_STATS (see ds_stats.h) */
+} deque;
+
+/**
+ * @brief Create a new deque.
+ * @param init_size Initial capacity hint.
+ * @note if the init_size <= 0 the capacity defaults to 16, otherwise it is rounded up to a power of two. the ring doubles when full.
+ * @return Pointer to the newly created deque, or NULL on failure.
+ */
+deque* create_deque(ssize_t init_size);
+
+/**
+ * @brief Create a new deque whose struct and ring come from an allocator.
+ * @param init_size Initial capacity hint.
+ * @param allocator Allocator to use (NULL for malloc), it must outlive the deque.
+ * @note see create_deque.
+ * @return Pointer to the newly created deque, or NULL on failure.
+ */
+deque* create_deque_with(ssize_t init_size, const ds_allocator* allocator);
+
+/**
+ * @brief Free the deque and its elements.
+ * @param dq Pointer to the deque.
+ * @param free_element Function pointer to free the elements (can be NULL).
+ * @note If the deque owns the memory of its elements, pass a valid free_element function; otherwise, pass NULL to avoid freeing memory not owned by the deque.
+ * @return 0 on success, -1 on failure.
+ */
+int free_deque(deque *dq, void (*free_element) (void*));
+
+/**
+ * @brief Add an element at the front of the deque.
+ * @param dq Pointer to the deque.
+ * @param element Pointer to the element to add (can't be NULL).
+ * @return 0 on success, -1 on failure.
+ */
+int dqpush_front(deque *dq, void* element);
+
+/**
+ * @brief Add an element at the back of the deque.
+ * @param dq Pointer to the deque.
+ * @param element Pointer to the element to add (can't be NULL).
+ * @return 0 on success, -1 on failure.
+ */
+int dqpush_back(deque *dq, void* element);
+
+/**
+ * @brief Remove the front element of the deque.
+ * @param dq Pointer to the deque.
+ * @note The memory ownership of the removed element is transferred (if it is owned by the deque) to the caller.
+ * @return Pointer to the removed element, or NULL if the deque is empty.
+ */
+void* dqpop_front(deque *dq);
+
+/**
+ * @brief Remove the back element of the deque.
+ * @param dq Pointer to the deque.
+ * @note The memory ownership of the removed element is transferred (if it is owned by the deque) to the caller.
+ * @return Pointer to the removed element, or NULL if the deque is empty.
+ */
+void* dqpop_back(deque *dq);
+
+/**
+ * @brief Add several elements at the back of the deque, in order.
+ * @param dq Pointer to the deque.
+ * @param elements Array of element pointers to add (none of them can be NULL).
+ * @param count Number of elements in the array.
+ * @note the capacity is checked once and the batch is copied with at most two memcpy calls. nothing is added on failure.
+ * @return 0 on success, -1 on failure.
+ */
+int dqpush_back_many(deque *dq, void** elements, ssize_t count);
+
+/**
+ * @brief Remove up to max_count elements from the front of the deque.
+ * @param dq Pointer to the deque.
+ * @param out Array receiving the removed element pointers, front first.
+ * @param max_count Capacity of the out array.
+ * @note The memory ownership of the removed elements is transferred (if it is owned by the deque) to the caller.
+ * @return Number of elements removed (0 if the deque is empty), or -1 on failure.
+ */
+ssize_t dqpop_front_many(deque *dq, void** out, ssize_t max_count);
+
+/**
+ * @brief Peek at the front element without removing it.
+ * @param dq Pointer to the deque.
+ * @return Pointer to the front element, or NULL if the deque is empty.
+ */
+void* dqfront(const deque *dq);
+
+/**
+ * @brief Peek at the back element without removing it.
+ * @param dq Pointer to the deque.
+ * @return Pointer to the back element, or NULL if the deque is empty.
+ */
+void* dqback(const deque *dq);
+
+/**
+ * @brief Get the element at a specific index, counted from the front.
+ * @param dq Pointer to the deque.
+ * @param index Index of the element to retrieve.
+ * @return Pointer to the element, or NULL if index is out of range.
+ */
+void* dqget(const deque *dq, ssize_t index);
+
+/**
+ * @brief Set the element at a specific index, counted from the front.
+ * @param dq Pointer to the deque.
+ * @param index Index of the element to set.
+ * @param element Pointer to the new element (can't be NULL).
+ * @param free_element Function pointer to free the old element (can be NULL).
+ * @note The old element pointer will no longer be in the deque, so if the deque owns it, free it using the provided function; otherwise, pass NULL.
+ * @return 0 on success, -1 on failure.
+ */
+int dqset(deque *dq, ssize_t index, void* element, void (*free_element) (void*));
+
+/**
+ * @brief Get the index of an element in the deque.
+ * @param dq Pointer to the deque.
+ * @param element Pointer to the element to find.
+ * @param compare Function pointer to compare two elements.
+ * @note The compare function should return 0 if the elements match, -1 otherwise.
+ * @return Index of the element counted from the front, or -1 if not found.
+ */
+ssize_t dqget_index(const deque *dq, void* element, int (*compare) (void*, void*));
+
+/**
+ * @brief Print all elements in the deque, front first.
+ * @param dq Pointer to the deque.
+ * @param print_element Function pointer to print each element.
+ */
+void dqprint(const deque *dq, void (*print_element) (void*));
+
+/**
+ * @brief Copy out the cost counters of the deque.
+ * @param dq Pointer to the deque.
+ * @param out Pointer receiving the counters.
+ * @note only available when the library is built with DS_STATS, see ds_stats.h.
+ * @return 0 on success, -1 on failure or when the counters are compiled out (out is zeroed then).
+ */
+int dqget_stats(const deque *dq, ds_stats* out);
+
+/**
+ * @brief Reset the cost counters of the deque.
+ * @param dq Pointer to the deque.
+ * @note the peaks restart from the current length and capacity.
+ * @return 0 on success, -1 on failure or when the counters are compiled out.
+ */
+int dqreset_stats(deque *dq);
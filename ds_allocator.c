@@ -0,0 +1,166 @@
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include "ds_allocator.h"
+
+#define ARENA_BLOCK_SIZE (64 * 1024)
+#define ARENA_ALIGN _Alignof(max_align_t)
+
+// ----------------- default allocator -----------------
+
+static void* default_alloc(void* ctx, size_t size){
+    (void)ctx;
+    return malloc(size);
+}
+
+static void* default_realloc(void* ctx, void* ptr, size_t old_size, size_t new_size){
+    (void)ctx;
+    (void)old_size;
+    return realloc(ptr, new_size);
+}
+
+static void default_free(void* ctx, void* ptr, size_t size){
+    (void)ctx;
+    (void)size;
+    free(ptr);
+}
+
+static const ds_allocator default_allocator = { default_alloc, default_realloc, default_free, NULL };
+
+const ds_allocator* ds_default_allocator(void){
+    return &default_allocator;
+}
+
+// ----------------- arena -----------------
+
+struct arena_block {
+    struct arena_block* next;
+    size_t size;
+    _Alignas(max_align_t) char data[];
+};
+
+static size_t align_up(size_t size){
+    return (size + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1);
+}
+
+static int add_block(ds_arena* arena, size_t needed){
+    size_t size = (needed > arena->block_size ? needed : arena->block_size);
+
+    if (size > SIZE_MAX - sizeof(struct arena_block)) return -1;
+
+    struct arena_block* block = malloc(sizeof(struct arena_block) + size);
+
+    if (block == NULL) return -1;
+
+    block->next = arena->blocks;
+    block->size = size;
+    arena->blocks = block;
+    arena->bump = block->data;
+    arena->end = block->data + size;
+
+    return 0;
+}
+
+static void* arena_alloc(void* ctx, size_t size){
+    ds_arena* arena = ctx;
+
+    if (size > SIZE_MAX - ARENA_ALIGN) return NULL;
+    size = align_up(size > 0 ? size : 1);
+
+    if ((size_t)(arena->end - arena->bump) < size)
+        if (add_block(arena, size) == -1) return NULL;
+
+    void* ptr = arena->bump;
+    arena->bump += size;
+    arena->last = ptr;
+
+    return ptr;
+}
+
+static void* arena_realloc(void* ctx, void* ptr, size_t old_size, size_t new_size){
+    ds_arena* arena = ctx;
+
+    if (ptr == NULL) return arena_alloc(ctx, new_size);
+    if (new_size > SIZE_MAX - ARENA_ALIGN) return NULL;
+
+    // the latest allocation grows or shrinks in place while its block has room
+    if (ptr == arena->last && (size_t)(arena->end - (char*)ptr) >= align_up(new_size > 0 ? new_size : 1)){
+        arena->bump = (char*)ptr + align_up(new_size > 0 ? new_size : 1);
+        return ptr;
+    }
+
+    void* new_ptr = arena_alloc(ctx, new_size);
+
+    if (new_ptr == NULL) return NULL;
+
+    memcpy(new_ptr, ptr, (old_size < new_size ? old_size : new_size));
+
+    return new_ptr;
+}
+
+static void arena_free(void* ctx, void* ptr, size_t size){
+    ds_arena* arena = ctx;
+    (void)size;
+
+    // only the latest allocation can be given back, the rest waits for arena_reset
+    if (ptr != NULL && ptr == arena->last){
+        arena->bump = ptr;
+        arena->last = NULL;
+    }
+}
+
+ds_arena* create_arena(size_t block_size){
+    ds_arena* arena = malloc(sizeof(ds_arena));
+
+    if (arena == NULL) return NULL;
+
+    arena->blocks = NULL;
+    arena->bump = NULL;
+    arena->end = NULL;
+    arena->last = NULL;
+    arena->block_size = (block_size > 0 ? block_size : ARENA_BLOCK_SIZE);
+    arena->allocator = (ds_allocator){ arena_alloc, arena_realloc, arena_free, arena };
+
+    return arena;
+}
+
+const ds_allocator* arena_allocator(ds_arena *arena){
+    if (arena == NULL) return NULL;
+
+    return &arena->allocator;
+}
+
+void arena_reset(ds_arena *arena){
+    if (arena == NULL || arena->blocks == NULL) return;
+
+    // keep the most recent block, it is the one in use
+    struct arena_block* block = arena->blocks->next;
+    struct arena_block* temp_next;
+
+    while (block != NULL){
+        temp_next = block->next;
+        free(block);
+        block = temp_next;
+    }
+
+    arena->blocks->next = NULL;
+    arena->bump = arena->blocks->data;
+    arena->end = arena->blocks->data + arena->blocks->size;
+    arena->last = NULL;
+}
+
+void free_arena(ds_arena *arena){
+    if (arena == NULL) return;
+
+    struct arena_block* block = arena->blocks;
+    struct arena_block* temp_next;
+
+    while (block != NULL){
+        temp_next = block->next;
+        free(block);
+        block = temp_next;
+    }
+
+    free(arena);
+}
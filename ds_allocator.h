@@ -0,0 +1,63 @@
+#pragma once
+
+#include <stddef.h>
+
+/**
+ * @brief Allocator used by a container for its own struct and its backing storage.
+ * @note every call receives ctx, and realloc and free also get the size of the block (as it was requested), so allocators that don't keep headers can use it.
+ * @note the allocator (and whatever ctx points to) must outlive every container created with it.
+ */
+typedef struct ds_allocator {
+    void* (*alloc) (void* ctx, size_t size);                                   /**< Allocate size bytes, NULL on failure */
+    void* (*realloc) (void* ctx, void* ptr, size_t old_size, size_t new_size); /**< Resize a block like realloc, NULL on failure (the old block stays valid) */
+    void (*free) (void* ctx, void* ptr, size_t size);                          /**< Release a block (ptr can be NULL) */
+    void* ctx;                                                                 /**< Opaque state passed to every call */
+} ds_allocator;
+
+/**
+ * @brief Allocator backed by malloc, realloc and free, the one used by the plain create_* functions.
+ * @return Pointer to the static default allocator.
+ */
+const ds_allocator* ds_default_allocator(void);
+
+/**
+ * @brief Bump allocator handing out memory from big blocks, released all at once.
+ * @note freeing a block only gives memory back when it was the latest allocation, everything else is reclaimed by arena_reset. meant for request scoped containers: create them with the arena's allocator, then drop them all with one arena_reset instead of freeing them one by one.
+ * @note not thread safe.
+ */
+typedef struct ds_arena {
+    struct arena_block* blocks;  /**< Chain of blocks owned by the arena (most recent first) */
+    char* bump;                  /**< Next free byte in the most recent block */
+    char* end;                   /**< One past the last byte of the most recent block */
+    void* last;                  /**< Latest allocation, the only one realloc can grow in place */
+    size_t block_size;           /**< Size of a block, bigger requests get a block of their own */
+    ds_allocator allocator;      /**< Allocator handing out memory from this arena */
+} ds_arena;
+
+/**
+ * @brief Create a new arena.
+ * @param block_size Size in bytes of the blocks carved by the arena.
+ * @note if the block_size is 0 it defaults to 64 KiB.
+ * @return Pointer to the newly created arena, or NULL on failure.
+ */
+ds_arena* create_arena(size_t block_size);
+
+/**
+ * @brief Get the allocator to pass to the create_*_with functions.
+ * @param arena Pointer to the arena.
+ * @return Pointer to the arena's allocator, or NULL if arena is NULL.
+ */
+const ds_allocator* arena_allocator(ds_arena *arena);
+
+/**
+ * @brief Release everything allocated from the arena at once.
+ * @param arena Pointer to the arena.
+ * @note containers created with the arena's allocator are gone after this, don't call their free functions. the most recent block is kept for the next round of allocations.
+ */
+void arena_reset(ds_arena *arena);
+
+/**
+ * @brief Free the arena and all the memory allocated from it.
+ * @param arena Pointer to the arena.
+ */
+void free_arena(ds_arena *arena);
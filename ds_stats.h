@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdint.h>
+#include <sys/types.h>
+
+/**
+ * @brief Cost counters of a container.
+ * @note the counters only exist when the library is built with DS_STATS defined (cmake -DDS_STATS=ON). without it the containers carry no counters and every update compiles to nothing.
+ * @note DS_STATS changes the layout of the container structs, so the library and the code using it must be built with the same setting.
+ * @note the counters are bumped with relaxed atomic adds, so threads sharing a container for reading (alget from an alparallel_for job, ...) stay race free. the peaks are only updated by the functions that modify the container.
+ */
+typedef struct {
+    uint64_t operations;       /**< Calls to the access, insert, delete and search functions (including the ones they make to each other) */
+    uint64_t reallocations;    /**< Times the element array was reallocated (0 for linked lists) */
+    uint64_t bytes_moved;      /**< Bytes shifted or copied with memmove / memcpy (what realloc copies isn't known, so it isn't counted) */
+    uint64_t traversal_steps;  /**< Nodes walked or elements compared while looking for an index or an element */
+    ssize_t peak_length;       /**< Highest length reached */
+    ssize_t peak_capacity;     /**< Highest capacity reached, in elements (0 for linked lists) */
+} ds_stats;
+
+#ifdef DS_STATS
+
+#include <stdatomic.h>
+
+/**
+ * @brief Counters as stored in a container, copied out as a ds_stats.
+ */
+typedef struct {
+    _Atomic uint64_t operations;
+    _Atomic uint64_t reallocations;
+    _Atomic uint64_t bytes_moved;
+    _Atomic uint64_t traversal_steps;
+    ssize_t peak_length;
+    ssize_t peak_capacity;
+} ds_stats_counters;
+
+/** @brief Member holding the counters, placed at the end of every instrumented struct. */
+#define DS_STATS_MEMBER ds_stats_counters stats;
+
+// the counters are bookkeeping, so they are updated from const functions too, possibly from several readers at once
+#define DS_STAT_ADD(obj, field, n) \
+    ((void)atomic_fetch_add_explicit(&((ds_stats_counters*)&(obj)->stats)->field, (uint64_t)(n), memory_order_relaxed))
+#define DS_STAT_PEAK(obj, field, value) \
+    do { if ((value) > (obj)->stats.field) (obj)->stats.field = (value); } while (0)
+#define DS_STAT_RESET(obj, length, capacity) \
+    do { \
+        atomic_store_explicit(&(obj)->stats.operations, 0, memory_order_relaxed); \
+        atomic_store_explicit(&(obj)->stats.reallocations, 0, memory_order_relaxed); \
+        atomic_store_explicit(&(obj)->stats.bytes_moved, 0, memory_order_relaxed); \
+        atomic_store_explicit(&(obj)->stats.traversal_steps, 0, memory_order_relaxed); \
+        (obj)->stats.peak_length = (length); \
+        (obj)->stats.peak_capacity = (capacity); \
+    } while (0)
+#define DS_STAT_COPY(obj, out) \
+    do { \
+        (out)->operations = atomic_load_explicit(&(obj)->stats.operations, memory_order_relaxed); \
+        (out)->reallocations = atomic_load_explicit(&(obj)->stats.reallocations, memory_order_relaxed); \
+        (out)->bytes_moved = atomic_load_explicit(&(obj)->stats.bytes_moved, memory_order_relaxed); \
+        (out)->traversal_steps = atomic_load_explicit(&(obj)->stats.traversal_steps, memory_order_relaxed); \
+        (out)->peak_length = (obj)->stats.peak_length; \
+        (out)->peak_capacity = (obj)->stats.peak_capacity; \
+    } while (0)
+
+#else
+
+#define DS_STATS_MEMBER
+#define DS_STAT_ADD(obj, field, n) ((void)0)
+#define DS_STAT_PEAK(obj, field, value) ((void)0)
+#define DS_STAT_RESET(obj, length, capacity) ((void)0)
+
+#endif
@@ -0,0 +1,199 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/types.h>
+#include "gap_list.h"
+
+// position in arr of the element at index, skipping over the gap
+#define SLOT(list, index) ((index) < (list)->gap_start ? (index) : (index) + ((list)->gap_end - (list)->gap_start))
+
+gap_list* create_gap_list(ssize_t array_size){
+    ssize_t size;
+    // check if init_size is specified, if it <= 0 a default size of 10 is used
+    if (array_size > 0)
+        size = array_size;
+    else
+        size = 10;
+
+    if ((size_t)size > SIZE_MAX / sizeof(void*)) return NULL;
+
+    gap_list* list = malloc(sizeof(gap_list));
+
+    if (list == NULL) return NULL;
+
+    list->arr = malloc(sizeof(void*) * size);
+
+    if (list->arr == NULL){
+        free(list);
+        return NULL;
+    }
+
+    list->length = 0;
+    list->max_size = size;
+    list->gap_start = 0;
+    list->gap_end = size;
+
+    return list;
+}
+
+void free_gap_list(gap_list *list, void (*free_element) (void*)){
+    if (list == NULL) return;
+
+    if (free_element != NULL)
+        for (ssize_t i = 0; i < list->length; i++)
+            free_element(list->arr[SLOT(list, i)]);
+
+    free(list->arr);
+    free(list);
+}
+
+ssize_t glget_index(const gap_list *list, void* element, int (*compare) (void*, void*)){
+    if (list == NULL || element == NULL || compare == NULL) return -1;
+
+    // two plain scans, one on each side of the gap
+    for (ssize_t i = 0; i < list->gap_start; i++)
+        if (compare(list->arr[i], element) == 0) return i;
+
+    for (ssize_t i = list->gap_end; i < list->max_size; i++)
+        if (compare(list->arr[i], element) == 0) return i - (list->gap_end - list->gap_start);
+
+    return -1;
+}
+
+void glprint(const gap_list *list, void (*print_element) (void*)){
+    if (list == NULL || list->length == 0 || print_element == NULL) {
+        printf("[]\n");
+        return;
+    }
+
+    printf("[");
+
+    for (ssize_t i = 0; i < list->length; i++){
+        print_element(list->arr[SLOT(list, i)]);
+        printf(", ");
+    }
+
+    printf("\b\b]\n");
+}
+
+void glreverse(gap_list *list){
+    if (list == NULL) return;
+
+    ssize_t index1 = 0, index2 = list->length - 1;
+
+    while (index1 < index2){
+        void** ptr1 = &list->arr[SLOT(list, index1)];
+        void** ptr2 = &list->arr[SLOT(list, index2)];
+        void* temp = *ptr1;
+        *ptr1 = *ptr2;
+        *ptr2 = temp;
+        index1++;
+        index2--;
+    }
+}
+
+void* glget(const gap_list *list, ssize_t index){
+    if (list == NULL || index < 0 || index >= list->length) return NULL;
+
+    return list->arr[SLOT(list, index)];
+}
+
+int glset(gap_list *list, ssize_t index, void* element, void (*free_element) (void*)){
+    if (list == NULL || element == NULL || index < 0 || index >= list->length) return -1;
+
+    void** slot = &list->arr[SLOT(list, index)];
+
+    if (free_element != NULL) free_element(*slot);
+
+    *slot = element;
+
+    return 0;
+}
+
+// move the gap so it starts at index, shifting only the elements between the old and new position
+static void move_gap(gap_list* list, ssize_t index){
+    if (index < list->gap_start){
+        ssize_t count = list->gap_start - index;
+        memmove(&list->arr[list->gap_end - count], &list->arr[index], count * sizeof(void*));
+        list->gap_start -= count;
+        list->gap_end -= count;
+    } else if (index > list->gap_start){
+        ssize_t count = index - list->gap_start;
+        memmove(&list->arr[list->gap_start], &list->arr[list->gap_end], count * sizeof(void*));
+        list->gap_start += count;
+        list->gap_end += count;
+    }
+}
+
+// double the capacity, the extra room goes to the gap
+static int grow_gap(gap_list* list){
+    if ((size_t)list->max_size > SIZE_MAX / 2 / sizeof(void*)) return -1;
+
+    ssize_t new_size = list->max_size * 2;
+    void** new_arr = realloc(list->arr, new_size * sizeof(void*));
+
+    if (new_arr == NULL) return -1;
+
+    // the elements after the gap move to the end of the new array
+    ssize_t after = list->max_size - list->gap_end;
+    memmove(&new_arr[new_size - after], &new_arr[list->gap_end], after * sizeof(void*));
+
+    list->arr = new_arr;
+    list->gap_end = new_size - after;
+    list->max_size = new_size;
+
+    return 0;
+}
+
+int gladd(gap_list *list, ssize_t index, void* element){
+    if (list == NULL || element == NULL || index < 0 || index > list->length) return -1;
+
+    if (list->gap_start == list->gap_end)
+        if (grow_gap(list) == -1) return -1;
+
+    move_gap(list, index);
+
+    list->arr[list->gap_start++] = element;
+    list->length++;
+
+    return 0;
+}
+
+int glappend(gap_list *list, void* element){
+    if (list == NULL) return -1;
+    return gladd(list, list->length, element);
+}
+
+int gldelete(gap_list *list, ssize_t index, void (*free_element)(void*)){
+    if (list == NULL || index < 0 || index >= list->length) return -1;
+
+    // backspace: the element right before the gap is absorbed by it
+    if (index == list->gap_start - 1){
+        if (free_element != NULL) free_element(list->arr[index]);
+        list->gap_start--;
+        list->length--;
+        return 0;
+    }
+
+    move_gap(list, index);
+
+    if (free_element != NULL) free_element(list->arr[list->gap_end]);
+    list->gap_end++;
+    list->length--;
+
+    return 0;
+}
+
+int glpop(gap_list *list, void (*free_element)(void*)){
+    if (list == NULL) return -1;
+    return gldelete(list, list->length - 1, free_element);
+}
+
+void** glcompact(gap_list *list){
+    if (list == NULL) return NULL;
+
+    move_gap(list, list->length);
+
+    return list->arr;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <sys/types.h>
+
+/**
+ * @brief Array list backed by a gap buffer.
+ * @note the unused capacity sits as a gap at the position of the last edit. adding or deleting at (or next to) that position moves no elements, an edit further away first moves the gap there, shifting only the elements in between. indexed access stays O(1).
+ * @note unlike array_list the elements aren't contiguous while the gap is in the middle, use glcompact to get a plain array.
+ */
+typedef struct {
+    ssize_t length;      /**< Number of elements currently in the list */
+    ssize_t max_size;    /**< Maximum capacity of the array (elements plus gap) */
+    ssize_t gap_start;   /**< Index of the first gap slot, also the list index the gap sits at */
+    ssize_t gap_end;     /**< Index one past the last gap slot */
+    void** arr;          /**< Elements before the gap, then the gap, then the elements after it */
+} gap_list;
+
+/**
+ * @brief Create a new gap list with a specified initial size.
+ * @param array_size Initial capacity of the gap list.
+ * @note if the initial size is <=0 the size of the array will be defaulted to 10
+ * @note the size of the array doubles when full
+ * @return Pointer to the newly created gap list, or NULL on failure.
+ */
+gap_list* create_gap_list(ssize_t array_size);
+
+/**
+ * @brief Free the gap list and its elements.
+ * @param list Pointer to the gap list.
+ * @param free_element Function pointer to free the elements (can be NULL).
+ * @note If the list owns the memory of elements, pass a valid free_element function; otherwise, pass NULL to avoid freeing memory not owned by the list.
+ */
+void free_gap_list(gap_list *list, void (*free_element) (void*));
+
+/**
+ * @brief Get the index of an element in the gap list.
+ * @param list Pointer to the gap list.
+ * @param element Pointer to the element to find.
+ * @param compare Function pointer to compare two elements.
+ * @note The compare function should return 0 if the elements match, -1 otherwise.
+ * @return Index of the element, or -1 if not found.
+ */
+ssize_t glget_index(const gap_list *list, void* element, int (*compare) (void*, void*));
+
+/**
+ * @brief Print all elements in the gap list.
+ * @param list Pointer to the gap list.
+ * @param print_element Function pointer to print each element.
+ */
+void glprint(const gap_list *list, void (*print_element) (void*));
+
+/**
+ * @brief Reverse the gap list in place.
+ * @param list Pointer to the gap list.
+ */
+void glreverse(gap_list *list);
+
+/**
+ * @brief Get the element at a specific index.
+ * @param list Pointer to the gap list.
+ * @param index Index of the element to retrieve.
+ * @return Pointer to the element, or NULL if index is out of range.
+ */
+void *glget(const gap_list *list, ssize_t index);
+
+/**
+ * @brief Set the element at a specific index.
+ * @param list Pointer to the gap list.
+ * @param index Index of the element to set.
+ * @param element Pointer to the new element.
+ * @param free_element Function pointer to free the old element (can be NULL).
+ * @note The old element pointer will no longer be in the list, so if the list owns it, free it using the provided function; otherwise, pass NULL.
+ * @return 0 on success, -1 on failure.
+ */
+int glset(gap_list *list, ssize_t index, void* element, void (*free_element) (void*));
+
+/**
+ * @brief Append an element to the end of the gap list.
+ * @param list Pointer to the gap list.
+ * @param element Pointer to the element to append.
+ * @note moves the gap to the end first, so appending right after edits in the middle shifts the elements behind them once.
+ * @return 0 on success, -1 on failure.
+ */
+int glappend(gap_list *list, void* element);
+
+/**
+ * @brief Add an element at a specific index.
+ * @param list Pointer to the gap list.
+ * @param index Index at which to insert the element.
+ * @param element Pointer to the element to add.
+ * @note O(1) amortized when index is at the gap, O(distance to the gap) otherwise. the gap ends up right after the new element.
+ * @return 0 on success, -1 on failure.
+ */
+int gladd(gap_list *list, ssize_t index, void* element);
+
+/**
+ * @brief Remove the last element from the gap list.
+ * @param list Pointer to the gap list.
+ * @param free_element Function pointer to free the element (can be NULL).
+ * @note Memory ownership rules in free_gap_list apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int glpop(gap_list *list, void (*free_element)(void*));
+
+/**
+ * @brief Delete the element at a specific index.
+ * @param list Pointer to the gap list.
+ * @param index Index of the element to delete.
+ * @param free_element Function pointer to free the element (can be NULL).
+ * @note O(1) when index is at the gap (delete forward) or right before it (backspace), O(distance to the gap) otherwise.
+ * @note Memory ownership rules in free_gap_list apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int gldelete(gap_list *list, ssize_t index, void (*free_element)(void*));
+
+/**
+ * @brief Move the gap to the end so the elements are contiguous.
+ * @param list Pointer to the gap list.
+ * @note the returned array stays valid until the next edit of the list.
+ * @return Pointer to the length elements in order, or NULL on failure.
+ */
+void **glcompact(gap_list *list);
@@ -0,0 +1,178 @@
+#include <stdio.h>
+#include <sys/types.h>
+#include "intrusive_list.h"
+
+void init_intrusive_list(intrusive_list* list){
+    if (list == NULL) return;
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+}
+
+int clear_intrusive_list(intrusive_list* list, void (*release)(ilist_link*)){
+    if (list == NULL) return -1;
+
+    ilist_link* current = list->head;
+    ilist_link* temp_next;
+
+    while (current != NULL){
+        temp_next = current->next;
+        current->next = NULL;
+        current->prev = NULL;
+        if (release != NULL) release(current);
+        current = temp_next;
+    }
+
+    init_intrusive_list(list);
+
+    return 0;
+}
+
+ssize_t ilget_index(const intrusive_list* list, ilist_link* element, int (*compare) (ilist_link*, ilist_link*)){
+    if (list == NULL || element == NULL || compare == NULL) return -1;
+
+    ssize_t current_index = 0;
+
+    ilforeach(list, current){
+        if (compare(current, element) == 0) return current_index;
+        current_index++;
+    }
+
+    return -1;
+}
+
+void ilprint(const intrusive_list* list, void (*print_element) (ilist_link*)){
+    if (list == NULL || list->length == 0 || print_element == NULL) {
+        printf("[]\n");
+        return;
+    }
+
+    printf("[");
+
+    ilforeach(list, current){
+        print_element(current);
+        printf(", ");
+    }
+
+    printf("\b\b]\n");
+}
+
+void ilreverse(intrusive_list* list){
+    if (list == NULL) return;
+
+    ilist_link* current = list->head;
+
+    while (current != NULL){
+        ilist_link* next = current->next;
+        current->next = current->prev;
+        current->prev = next;
+        current = next;
+    }
+
+    ilist_link* temp_head = list->head;
+
+    list->head = list->tail;
+    list->tail = temp_head;
+}
+
+ilist_link* ilget(const intrusive_list* list, ssize_t index){
+    if (list == NULL || index < 0 || index >= list->length) return NULL;
+
+    ilist_link* current;
+
+    if (index < list->length / 2){
+        current = list->head;
+        for (ssize_t i = 0; i < index; i++) current = current->next;
+    } else {
+        current = list->tail;
+        for (ssize_t i = list->length - 1; i > index; i--) current = current->prev;
+    }
+
+    return current;
+}
+
+int ilinsert_after(intrusive_list* list, ilist_link* position, ilist_link* element){
+    if (list == NULL || element == NULL) return -1;
+
+    element->prev = position;
+    element->next = (position == NULL ? list->head : position->next);
+
+    if (element->next != NULL) element->next->prev = element;
+    else list->tail = element;
+
+    if (position != NULL) position->next = element;
+    else list->head = element;
+
+    list->length++;
+
+    return 0;
+}
+
+int ilset(intrusive_list* list, ssize_t index, ilist_link* element, void (*release) (ilist_link*)){
+    if (list == NULL || element == NULL || index < 0 || index >= list->length) return -1;
+
+    ilist_link* old = ilget(list, index);
+
+    // the new link takes the old one's place
+    element->prev = old->prev;
+    element->next = old->next;
+
+    if (old->prev != NULL) old->prev->next = element;
+    else list->head = element;
+
+    if (old->next != NULL) old->next->prev = element;
+    else list->tail = element;
+
+    old->next = NULL;
+    old->prev = NULL;
+    if (release != NULL) release(old);
+
+    return 0;
+}
+
+int ilappend(intrusive_list* list, ilist_link* element){
+    if (list == NULL || element == NULL) return -1;
+    return ilinsert_after(list, list->tail, element);
+}
+
+int iladd(intrusive_list* list, ssize_t index, ilist_link* element){
+    if (list == NULL || element == NULL) return -1;
+
+    if (index < 0 || index > list->length) return -1;
+
+    if (index == 0) return ilinsert_after(list, NULL, element);
+
+    return ilinsert_after(list, ilget(list, index - 1), element);
+}
+
+int ilremove(intrusive_list* list, ilist_link* element, void (*release)(ilist_link*)){
+    if (list == NULL || element == NULL || list->length == 0) return -1;
+
+    if (element->prev != NULL) element->prev->next = element->next;
+    else list->head = element->next;
+
+    if (element->next != NULL) element->next->prev = element->prev;
+    else list->tail = element->prev;
+
+    element->next = NULL;
+    element->prev = NULL;
+    list->length--;
+
+    if (release != NULL) release(element);
+
+    return 0;
+}
+
+int ilpop(intrusive_list* list, void (*release)(ilist_link*)){
+    if (list == NULL) return -1;
+    return ilremove(list, list->tail, release);
+}
+
+int ildelete(intrusive_list* list, ssize_t index, void (*release)(ilist_link*)){
+    if (list == NULL) return -1;
+
+    if (index < 0 || index >= list->length) return -1;
+
+    return ilremove(list, ilget(list, index), release);
+}
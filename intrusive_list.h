@@ -0,0 +1,156 @@
+#pragma once
+
+#include <stddef.h>
+#include <sys/types.h>
+
+/**
+ * @brief Link embedded by the caller in its own structs to put them on an intrusive list.
+ * @note a link can be on at most one list at a time.
+ */
+typedef struct ilist_link {
+    struct ilist_link* next;   /**< Pointer to the next link in the list */
+    struct ilist_link* prev;   /**< Pointer to the previous link in the list */
+} ilist_link;
+
+/**
+ * @brief Intrusive doubly linked list: it links the callers' structs directly and never allocates.
+ * @note the list itself can be embedded too; initialize it with init_intrusive_list.
+ */
+typedef struct {
+    ilist_link* head;    /**< Pointer to the first link */
+    ilist_link* tail;    /**< Pointer to the last link */
+    ssize_t length;      /**< Number of links in the list */
+} intrusive_list;
+
+/**
+ * @brief Get the struct containing a link.
+ * @param link Pointer to the embedded link.
+ * @param type Type of the containing struct.
+ * @param member Name of the link member inside the struct.
+ */
+#define ilist_entry(link, type, member) ((type*)((char*)(link) - offsetof(type, member)))
+
+/**
+ * @brief Iterate over the links of a list from head to tail.
+ * @param list Pointer to the intrusive list.
+ * @param it Name of the ilist_link* loop variable.
+ * @note the current link must not be removed inside the loop, use ilforeach_safe for that.
+ */
+#define ilforeach(list, it) for (ilist_link* it = (list)->head; it != NULL; it = it->next)
+
+/**
+ * @brief Iterate over the links of a list, allowing the current link to be removed.
+ * @param list Pointer to the intrusive list.
+ * @param it Name of the ilist_link* loop variable.
+ * @param tmp Name of an ilist_link* variable holding the next link.
+ */
+#define ilforeach_safe(list, it, tmp) for (ilist_link* it = (list)->head, *tmp = (it ? it->next : NULL); it != NULL; it = tmp, tmp = (it ? it->next : NULL))
+
+/**
+ * @brief Initialize an empty intrusive list.
+ * @param list Pointer to the intrusive list.
+ */
+void init_intrusive_list(intrusive_list *list);
+
+/**
+ * @brief Unlink every link from the list.
+ * @param list Pointer to the intrusive list.
+ * @param release Function pointer called with each unlinked link (can be NULL).
+ * @note the list does not own the structs containing the links; pass a release function if the structs should be freed (use ilist_entry to get them), otherwise pass NULL.
+ * @return 0 on success, -1 on failure.
+ */
+int clear_intrusive_list(intrusive_list *list, void (*release)(ilist_link*));
+
+/**
+ * @brief Get the index of a link in the list.
+ * @param list Pointer to the intrusive list.
+ * @param element Pointer to the link to find.
+ * @param compare Function pointer to compare the passed link with the list links.
+ * @note compare passed function should return 0 on success (the two element match) and -1 on failure.
+ * @return Index of the link, or -1 if not found.
+ */
+ssize_t ilget_index(const intrusive_list *list, ilist_link* element, int (*compare) (ilist_link*, ilist_link*));
+
+/**
+ * @brief Print the list.
+ * @param list Pointer to the intrusive list.
+ * @param print_element Function pointer to print each link.
+ */
+void ilprint(const intrusive_list *list, void (*print_element) (ilist_link*));
+
+/**
+ * @brief Reverse the list in place.
+ * @param list Pointer to the intrusive list.
+ */
+void ilreverse(intrusive_list *list);
+
+/**
+ * @brief Get the link at a specific index.
+ * @param list Pointer to the intrusive list.
+ * @param index Index of the link to retrieve.
+ * @note the walk starts from whichever end of the list is closer to the index.
+ * @return Pointer to the link, or NULL if index is out of range.
+ */
+ilist_link *ilget(const intrusive_list *list, ssize_t index);
+
+/**
+ * @brief Replace the link at a specific index.
+ * @param list Pointer to the intrusive list.
+ * @param index Index of the link to replace.
+ * @param element Pointer to the new link (must not be on a list).
+ * @param release Function pointer called with the replaced link (can be NULL).
+ * @return 0 on success, -1 on failure.
+ */
+int ilset(intrusive_list *list, ssize_t index, ilist_link* element, void (*release) (ilist_link*));
+
+/**
+ * @brief Append a link to the end of the list.
+ * @param list Pointer to the intrusive list.
+ * @param element Pointer to the link to append (must not be on a list).
+ * @return 0 on success, -1 on failure.
+ */
+int ilappend(intrusive_list *list, ilist_link* element);
+
+/**
+ * @brief Add a link at a specific index.
+ * @param list Pointer to the intrusive list.
+ * @param index Index at which to insert the link.
+ * @param element Pointer to the link to add (must not be on a list).
+ * @return 0 on success, -1 on failure.
+ */
+int iladd(intrusive_list *list, ssize_t index, ilist_link* element);
+
+/**
+ * @brief Insert a link right after a link already on the list, in O(1).
+ * @param list Pointer to the intrusive list.
+ * @param position Pointer to a link on the list, or NULL to insert at the head.
+ * @param element Pointer to the link to add (must not be on a list).
+ * @return 0 on success, -1 on failure.
+ */
+int ilinsert_after(intrusive_list *list, ilist_link* position, ilist_link* element);
+
+/**
+ * @brief Remove the last link from the list.
+ * @param list Pointer to the intrusive list.
+ * @param release Function pointer called with the removed link (can be NULL).
+ * @return 0 on success, -1 on failure.
+ */
+int ilpop(intrusive_list *list, void (*release)(ilist_link*));
+
+/**
+ * @brief Delete the link at a specific index.
+ * @param list Pointer to the intrusive list.
+ * @param index Index of the link to delete.
+ * @param release Function pointer called with the removed link (can be NULL).
+ * @return 0 on success, -1 on failure.
+ */
+int ildelete(intrusive_list *list, ssize_t index, void (*release)(ilist_link*));
+
+/**
+ * @brief Unlink a link known to be on the list, in O(1).
+ * @param list Pointer to the intrusive list holding the link.
+ * @param element Pointer to the link to remove.
+ * @param release Function pointer called with the removed link (can be NULL).
+ * @return 0 on success, -1 on failure.
+ */
+int ilremove(intrusive_list *list, ilist_link* element, void (*release)(ilist_link*));
@@ -0,0 +1,180 @@
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include "lf_stack.h"
+
+#define TAG_OF(word) ((word) >> 32)
+#define INDEX_OF(word) ((uint32_t)(word))
+#define MAKE_WORD(tag, index) (((uint64_t)(tag) << 32) | (uint64_t)(index))
+
+// node index i lives in segment k = floor(log2(i / FIRST + 1)), which starts at index FIRST * (2^k - 1)
+static int segment_of(uint32_t index){
+    uint64_t q = (uint64_t)index / LF_STACK_FIRST_SEGMENT + 1;
+    return 63 - __builtin_clzll(q);
+}
+
+static uint64_t segment_start(int k){
+    return (uint64_t)LF_STACK_FIRST_SEGMENT * (((uint64_t)1 << k) - 1);
+}
+
+static lf_stack_node* get_node(lf_stack* stck, uint32_t index){
+    int k = segment_of(index);
+    lf_stack_node* segment = atomic_load_explicit(&stck->segments[k], memory_order_acquire);
+    return &segment[index - segment_start(k)];
+}
+
+static int ensure_segment(lf_stack* stck, int k){
+    if (k >= LF_STACK_SEGMENTS) return -1;
+    if (atomic_load_explicit(&stck->segments[k], memory_order_acquire) != NULL) return 0;
+
+    lf_stack_node* segment = calloc((size_t)LF_STACK_FIRST_SEGMENT << k, sizeof(lf_stack_node));
+    if (segment == NULL) return -1;
+
+    // several threads may race to add the same segment, the losers drop theirs
+    lf_stack_node* expected = NULL;
+    if (!atomic_compare_exchange_strong_explicit(&stck->segments[k], &expected, segment, memory_order_acq_rel, memory_order_acquire))
+        free(segment);
+
+    return 0;
+}
+
+static void backoff(unsigned* spins){
+    unsigned rounds = 1u << (*spins < 10 ? *spins : 10);
+    for (unsigned i = 0; i < rounds; i++){
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+    }
+    (*spins)++;
+}
+
+// both the stack and its free list are tagged Treiber stacks of node indices (stored + 1 so 0 means empty)
+static void push_index(lf_stack* stck, _Atomic uint64_t* head, uint32_t index){
+    lf_stack_node* n = get_node(stck, index);
+    uint64_t old = atomic_load_explicit(head, memory_order_relaxed);
+    unsigned spins = 0;
+
+    for (;;){
+        atomic_store_explicit(&n->next, INDEX_OF(old), memory_order_relaxed);
+        uint64_t new_word = MAKE_WORD(TAG_OF(old) + 1, index + 1);
+        if (atomic_compare_exchange_weak_explicit(head, &old, new_word, memory_order_release, memory_order_relaxed))
+            return;
+        backoff(&spins);
+    }
+}
+
+static int pop_index(lf_stack* stck, _Atomic uint64_t* head, uint32_t* index){
+    uint64_t old = atomic_load_explicit(head, memory_order_acquire);
+    unsigned spins = 0;
+
+    for (;;){
+        if (INDEX_OF(old) == 0) return -1;
+
+        // the node may be popped and reused meanwhile, its memory stays valid and the tag makes the CAS fail
+        lf_stack_node* n = get_node(stck, INDEX_OF(old) - 1);
+        uint32_t next = atomic_load_explicit(&n->next, memory_order_relaxed);
+        uint64_t new_word = MAKE_WORD(TAG_OF(old) + 1, next);
+
+        if (atomic_compare_exchange_weak_explicit(head, &old, new_word, memory_order_acquire, memory_order_acquire)){
+            *index = INDEX_OF(old) - 1;
+            return 0;
+        }
+        backoff(&spins);
+    }
+}
+
+static int alloc_index(lf_stack* stck, uint32_t* index){
+    if (pop_index(stck, &stck->free_nodes, index) == 0) return 0;
+
+    uint32_t fresh = atomic_fetch_add_explicit(&stck->allocated, 1, memory_order_relaxed);
+    // index + 1 has to fit in 32 bits
+    if (fresh == UINT32_MAX){
+        atomic_fetch_sub_explicit(&stck->allocated, 1, memory_order_relaxed);
+        return -1;
+    }
+    if (ensure_segment(stck, segment_of(fresh)) == -1) return -1;
+
+    *index = fresh;
+    return 0;
+}
+
+lf_stack* create_lf_stack(ssize_t init_size){
+    // the hot words are cache line aligned, which malloc does not guarantee
+    lf_stack* stck = aligned_alloc(LF_STACK_CACHE_LINE, sizeof(lf_stack));
+
+    if (stck == NULL) return NULL;
+
+    atomic_init(&stck->top, 0);
+    atomic_init(&stck->free_nodes, 0);
+    atomic_init(&stck->allocated, 0);
+    for (int k = 0; k < LF_STACK_SEGMENTS; k++)
+        atomic_init(&stck->segments[k], NULL);
+
+    int last = (init_size > 0 && (uint64_t)init_size <= UINT32_MAX ? segment_of((uint32_t)(init_size - 1)) : 0);
+
+    for (int k = 0; k <= last; k++){
+        if (ensure_segment(stck, k) == -1){
+            free_lf_stack(stck, NULL);
+            return NULL;
+        }
+    }
+
+    return stck;
+}
+
+int lf_stack_push(lf_stack* stck, void* element){
+    if (stck == NULL || element == NULL) return -1;
+
+    uint32_t index;
+
+    if (alloc_index(stck, &index) == -1) return -1;
+
+    atomic_store_explicit(&get_node(stck, index)->value, element, memory_order_relaxed);
+    push_index(stck, &stck->top, index);
+
+    return 0;
+}
+
+void* lf_stack_pop(lf_stack* stck){
+    if (stck == NULL) return NULL;
+
+    uint32_t index;
+
+    if (pop_index(stck, &stck->top, &index) == -1) return NULL;
+
+    void* popped = atomic_load_explicit(&get_node(stck, index)->value, memory_order_relaxed);
+    push_index(stck, &stck->free_nodes, index);
+
+    return popped;
+}
+
+void* lf_stack_peek(lf_stack* stck){
+    if (stck == NULL) return NULL;
+
+    uint64_t top = atomic_load_explicit(&stck->top, memory_order_acquire);
+
+    if (INDEX_OF(top) == 0) return NULL;
+
+    return atomic_load_explicit(&get_node(stck, INDEX_OF(top) - 1)->value, memory_order_relaxed);
+}
+
+int free_lf_stack(lf_stack* stck, void (*free_element) (void*)){
+    if (stck == NULL) return -1;
+
+    if (free_element != NULL){
+        uint32_t current = INDEX_OF(atomic_load_explicit(&stck->top, memory_order_acquire));
+        while (current != 0){
+            lf_stack_node* n = get_node(stck, current - 1);
+            free_element(atomic_load_explicit(&n->value, memory_order_relaxed));
+            current = atomic_load_explicit(&n->next, memory_order_relaxed);
+        }
+    }
+
+    for (int k = 0; k < LF_STACK_SEGMENTS; k++)
+        free(atomic_load_explicit(&stck->segments[k], memory_order_relaxed));
+
+    free(stck);
+
+    return 0;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+#define LF_STACK_CACHE_LINE 64
+#define LF_STACK_SEGMENTS 27        /**< enough doubling segments to address 2^32 nodes */
+#define LF_STACK_FIRST_SEGMENT 64   /**< number of nodes in the first segment */
+
+/**
+ * @brief Node of a lock-free stack.
+ */
+typedef struct {
+    _Atomic(void*) value;     /**< Pointer to the data stored in the node */
+    _Atomic uint32_t next;    /**< Index + 1 of the node below this one, 0 for none */
+} lf_stack_node;
+
+/**
+ * @brief Lock-free (Treiber) stack safe to share between threads.
+ * @note nodes are addressed by 32-bit indices and the top of the stack is a 64-bit word packing the index with a tag bumped on every change, so a CAS fails whenever the top was popped and pushed back in between (no ABA).
+ * @note popped nodes go to a lock-free free list and are reused by later pushes; node memory is only returned to the system by free_lf_stack, so a thread reading a node that was popped concurrently never touches freed memory.
+ */
+typedef struct {
+    _Alignas(LF_STACK_CACHE_LINE) _Atomic uint64_t top;        /**< Tagged index of the top node */
+    _Alignas(LF_STACK_CACHE_LINE) _Atomic uint64_t free_nodes; /**< Tagged index of the first unused node */
+    _Alignas(LF_STACK_CACHE_LINE) _Atomic uint32_t allocated;  /**< Number of node indices handed out so far */
+    _Atomic(lf_stack_node*) segments[LF_STACK_SEGMENTS];       /**< Node storage, segment k holds LF_STACK_FIRST_SEGMENT << k nodes */
+} lf_stack;
+
+/**
+ * @brief Create a new lock-free stack.
+ * @param init_size Number of nodes to preallocate.
+ * @note if the init_size <= 0 only the first segment of 64 nodes is allocated. more segments are added (without locking) as the stack grows.
+ * @return Pointer to the newly created stack, or NULL on failure.
+ */
+lf_stack* create_lf_stack(ssize_t init_size);
+
+/**
+ * @brief Push an element onto the top of the stack.
+ * @param stck Pointer to the stack.
+ * @param element Pointer to the element to push (can't be NULL).
+ * @return 0 on success, -1 on failure.
+ */
+int lf_stack_push(lf_stack *stck, void* element);
+
+/**
+ * @brief Pop the top element from the stack.
+ * @param stck Pointer to the stack.
+ * @note The memory ownership (if it is owned by the stack) of the popped element is transfered to the caller, i.e. the caller is responsible for freeing the returned element if needed.
+ * @return Pointer to the popped element, or NULL if the stack is empty.
+ */
+void* lf_stack_pop(lf_stack *stck);
+
+/**
+ * @brief Peek at the top element of the stack without removing it.
+ * @param stck Pointer to the stack.
+ * @note no memory ownership gets transfered here. with concurrent poppers the element may be popped (and freed by its new owner) right after the call returns, so the result can only be dereferenced while no other thread pops.
+ * @return Pointer to the top element, or NULL if the stack is empty.
+ */
+void* lf_stack_peek(lf_stack *stck);
+
+/**
+ * @brief Free the stack and its elements.
+ * @param stck Pointer to the stack.
+ * @param free_element Function pointer to free the elements (can be NULL).
+ * @note must not run concurrently with any other operation on the stack. memory ownership rules in free_stack apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int free_lf_stack(lf_stack *stck, void (*free_element) (void*));
@@ -2,46 +2,106 @@
 #include <stdio.h>
 #include <sys/types.h>
 #include "linked_list.h"
+#include "node_pool.h"
 
 node* create_node(void* element){
+    return create_node_with(element, NULL);
+}
+
+node* create_node_with(void* element, const ds_allocator* allocator){
     if (element == NULL) return NULL;
+    if (allocator == NULL) allocator = ds_default_allocator();
 
-    node* n = malloc(sizeof(node));
+    node* n = allocator->alloc(allocator->ctx, sizeof(node));
     
     if (n == NULL) return NULL;
     
     n->value = element;
     n->next = NULL;
+    n->prev = NULL;
     
     return n;
 }
 
 linked_list* create_linked_list(){
-    linked_list* list = malloc(sizeof(linked_list));
+    return create_linked_list_with(NULL);
+}
+
+linked_list* create_linked_list_with(const ds_allocator* allocator){
+    if (allocator == NULL) allocator = ds_default_allocator();
+
+    linked_list* list = allocator->alloc(allocator->ctx, sizeof(linked_list));
     
     if (list == NULL) return NULL;
     
     list->head = NULL;
     list->tail = NULL;
     list->length = 0;
+    list->pool = NULL;
+    list->owns_pool = 0;
+    list->allocator = allocator;
+    DS_STAT_RESET(list, 0, 0);
     
     return list;
 }
 
+linked_list* create_pooled_linked_list(node_pool* pool){
+    return create_pooled_linked_list_with(pool, NULL);
+}
+
+linked_list* create_pooled_linked_list_with(node_pool* pool, const ds_allocator* allocator){
+    linked_list* list = create_linked_list_with(allocator);
+
+    if (list == NULL) return NULL;
+
+    if (pool == NULL){
+        pool = create_node_pool_with(0, list->allocator);
+        if (pool == NULL){
+            list->allocator->free(list->allocator->ctx, list, sizeof(linked_list));
+            return NULL;
+        }
+        list->owns_pool = 1;
+    }
+
+    list->pool = pool;
+
+    return list;
+}
+
+static node* alloc_node(linked_list* list, void* element){
+    if (list->pool != NULL) return pool_alloc_node(list->pool, element);
+    return create_node_with(element, list->allocator);
+}
+
+static void release_node(linked_list* list, node* n){
+    if (list->pool != NULL) pool_free_node(list->pool, n);
+    else list->allocator->free(list->allocator->ctx, n, sizeof(node));
+}
+
 int free_linked_list(linked_list* list, void (*free_element)(void*)){
     if (list == NULL) return -1;
-    
-    node* delete_pointer = list->head;
-    node* temp_next; 
-    
-    while (delete_pointer != NULL){
-        temp_next = delete_pointer->next;
+
+    ll_cursor cursor = llcursor_begin(list);
+
+    // a private pool is released slab by slab, so nodes only need a visit to free their elements
+    if (list->owns_pool){
+        if (free_element != NULL){
+            for (; llcursor_valid(&cursor); llcursor_next(&cursor))
+                free_element(llcursor_get(&cursor));
+        }
+        free_node_pool(list->pool);
+        list->allocator->free(list->allocator->ctx, list, sizeof(linked_list));
+        return 0;
+    }
+
+    while (llcursor_valid(&cursor)){
+        node* delete_pointer = cursor.current;
+        llcursor_next(&cursor);
         if (free_element != NULL) free_element(delete_pointer->value);
-        free(delete_pointer);
-        delete_pointer = temp_next;
+        release_node(list, delete_pointer);
     }
 
-    free(list);
+    list->allocator->free(list->allocator->ctx, list, sizeof(linked_list));
 
     return 0;
 }
@@ -49,17 +109,18 @@ int free_linked_list(linked_list* list, void (*free_element)(void*)){
 ssize_t llget_index(const linked_list* list, void* element, int (*compare) (void*, void*)) 
 { 
     if (list == NULL || element == NULL || compare == NULL) return -1;
-    
-    node* current = list->head;
-    ssize_t current_index = 0;
-    
-    while (current != NULL) {
-        if (compare(current->value, element) == 0) return current_index;
 
-        current = current->next;
-        current_index++;
+    DS_STAT_ADD(list, operations, 1);
+
+    for (ll_cursor cursor = llcursor_begin(list); llcursor_valid(&cursor); llcursor_next(&cursor)){
+        if (compare(llcursor_get(&cursor), element) == 0){
+            DS_STAT_ADD(list, traversal_steps, cursor.index + 1);
+            return cursor.index;
+        }
     }
 
+    DS_STAT_ADD(list, traversal_steps, list->length);
+
     return -1;
 }
 
@@ -68,17 +129,14 @@ void llprint(const linked_list* list, void (*print_node) (void*)){
         printf("[]\n");
         return;
     }
-    
-    node* current = list->head;
-    
+
     printf("[");
-    
-    while (current != NULL) {
-        print_node(current->value);
-        current = current->next;
+
+    for (ll_cursor cursor = llcursor_begin(list); llcursor_valid(&cursor); llcursor_next(&cursor)) {
+        print_node(llcursor_get(&cursor));
         printf(", ");
     }
-    
+
     printf("\b\b]\n");
 }
 
@@ -93,6 +151,7 @@ void llreverse(linked_list* list){
      while (current != NULL) {
         next = current->next;  
         current->next = pre;   
+        current->prev = next;
         pre = current;         
         current = next;        
     }
@@ -108,19 +167,36 @@ node* llget_node(const linked_list* list, ssize_t index){
     if (index < 0) return NULL;
     if (index >= list->length) return NULL;
     
-    node* current = list->head;
-    ssize_t current_index = 0;
-
-     while (current != NULL && current_index < index) {
-        current = current->next;
-        current_index++;
+    node* current;
+    ssize_t current_index;
+
+    // walk from whichever end is closer to the index
+    if (index < list->length / 2){
+        current = list->head;
+        current_index = 0;
+
+        while (current != NULL && current_index < index) {
+            current = current->next;
+            current_index++;
+        }
+    } else {
+        current = list->tail;
+        current_index = list->length - 1;
+
+        while (current != NULL && current_index > index) {
+            current = current->prev;
+            current_index--;
+        }
     }
 
+    DS_STAT_ADD(list, traversal_steps, (index < list->length / 2 ? index : list->length - 1 - index));
+
     return current;
 }
 
 void* llget(const linked_list *list, ssize_t index){
     if (list == NULL || index < 0 || index >= list->length) return NULL;
+    DS_STAT_ADD(list, operations, 1);
     node* nd = llget_node(list, index);
 
     if (nd == NULL) return NULL;
@@ -131,6 +207,8 @@ void* llget(const linked_list *list, ssize_t index){
 int llset(linked_list *list, ssize_t index, void* element, void (*free_element) (void*)){
     if (list == NULL || element == NULL || index < 0 || index >= list->length) return -1;
 
+    DS_STAT_ADD(list, operations, 1);
+
     node* nd = llget_node(list, index);
 
     if (nd == NULL) return -1;
@@ -152,31 +230,38 @@ int lladd(linked_list*  list, ssize_t index, void* element){
     if (list == NULL || element == NULL) return -1;
 
     if (index < 0 || index > list->length) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
     
-    node* newnode = create_node(element);
+    node* newnode = alloc_node(list, element);
 
     if (newnode == NULL) return -1;
 
     if (list->length == 0){
         list->head = newnode;
         list->tail = newnode;
-        list->length++;   
+        list->length++;
+        DS_STAT_PEAK(list, peak_length, list->length);
         
         return 0;
     }
 
     if (index == 0) {
         newnode->next = list->head;
+        list->head->prev = newnode;
         list->head = newnode;
         list->length++;
+        DS_STAT_PEAK(list, peak_length, list->length);
        
         return 0;
     }
    
     if (index == list->length){
         list->tail->next = newnode;
+        newnode->prev = list->tail;
         list->tail = newnode;
         list->length++;
+        DS_STAT_PEAK(list, peak_length, list->length);
         
         return 0;
     }
@@ -188,9 +273,12 @@ int lladd(linked_list*  list, ssize_t index, void* element){
     node* postnode = prenode->next;
     
     prenode->next = newnode; 
+    newnode->prev = prenode;
     newnode->next = postnode;
+    postnode->prev = newnode;
     
     list->length++;
+    DS_STAT_PEAK(list, peak_length, list->length);
     
     return 0;
 }
@@ -204,11 +292,13 @@ int lldelete(linked_list*  list, ssize_t index, void (*free_element)(void*)){
     if (list == NULL) return -1;
    
     if (index < 0 || index >= list->length) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
     
     // check if the list one element
     if (list->length == 1 && index == 0) {
         if (free_element != NULL) free_element(list->head->value);
-        free(list->head);
+        release_node(list, list->head);
         list->head = NULL;
         list->tail = NULL;
         list->length--;
@@ -219,8 +309,9 @@ int lldelete(linked_list*  list, ssize_t index, void (*free_element)(void*)){
     if (index == 0){
         node* oldhead = list->head;
         list->head = list->head->next;
+        list->head->prev = NULL;
         if (free_element != NULL) free_element(oldhead->value);
-        free(oldhead);
+        release_node(list, oldhead);
         list->length--;
         return 0;
     }
@@ -228,12 +319,11 @@ int lldelete(linked_list*  list, ssize_t index, void (*free_element)(void*)){
     // handle tail deletion
     if (index == list->length-1){
         node* old_tail = list->tail; 
-        node* pretail = llget_node(list, list->length-2); // lengt-2 to get the pre-tail node
-        if (pretail==NULL) return -1;
+        node* pretail = old_tail->prev;
         list->tail = pretail;
         list->tail->next = NULL; 
         if (free_element != NULL) free_element(old_tail->value);
-        free(old_tail);
+        release_node(list, old_tail);
         list->length--;
         return 0;
     }
@@ -246,9 +336,268 @@ int lldelete(linked_list*  list, ssize_t index, void (*free_element)(void*)){
     node* postnode = prenode->next->next;
     
     prenode->next = postnode;
+    postnode->prev = prenode;
+    if (free_element != NULL) free_element(deleted_node->value);
+    release_node(list, deleted_node);
+    list->length--;
+
+    return 0;
+}
+
+int lladd_range(linked_list* list, ssize_t index, void** elements, ssize_t count){
+    if (list == NULL || elements == NULL || count < 0) return -1;
+
+    if (index < 0 || index > list->length) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    if (count == 0) return 0;
+
+    // build the chain on the side first so a failed allocation leaves the list untouched
+    node* first = NULL;
+    node* last = NULL;
+
+    for (ssize_t i = 0; i < count; i++){
+        node* newnode = (elements[i] == NULL ? NULL : alloc_node(list, elements[i]));
+
+        if (newnode == NULL){
+            while (first != NULL){
+                node* temp_next = first->next;
+                release_node(list, first);
+                first = temp_next;
+            }
+            return -1;
+        }
+
+        newnode->prev = last;
+        if (last != NULL) last->next = newnode;
+        else first = newnode;
+        last = newnode;
+    }
+
+    node* prenode = (index == 0 ? NULL : llget_node(list, index - 1));
+    node* postnode = (prenode == NULL ? list->head : prenode->next);
+
+    first->prev = prenode;
+    last->next = postnode;
+
+    if (prenode != NULL) prenode->next = first;
+    else list->head = first;
+
+    if (postnode != NULL) postnode->prev = last;
+    else list->tail = last;
+
+    list->length += count;
+    DS_STAT_PEAK(list, peak_length, list->length);
+
+    return 0;
+}
+
+int lldelete_range(linked_list* list, ssize_t index, ssize_t count, void (*free_element)(void*)){
+    if (list == NULL || count < 0) return -1;
+
+    if (index < 0 || index > list->length || count > list->length - index) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    if (count == 0) return 0;
+
+    node* current = llget_node(list, index);
+    node* prenode = current->prev;
+
+    for (ssize_t i = 0; i < count; i++){
+        node* temp_next = current->next;
+        if (free_element != NULL) free_element(current->value);
+        release_node(list, current);
+        current = temp_next;
+    }
+
+    // current is now the first node after the deleted range
+    if (prenode != NULL) prenode->next = current;
+    else list->head = current;
+
+    if (current != NULL) current->prev = prenode;
+    else list->tail = prenode;
+
+    list->length -= count;
+
+    return 0;
+}
+
+ll_cursor llcursor_begin(const linked_list* list){
+    ll_cursor cursor = { NULL, 0 };
+
+    if (list != NULL) cursor.current = list->head;
+
+    return cursor;
+}
+
+ll_cursor llcursor_last(const linked_list* list){
+    ll_cursor cursor = { NULL, -1 };
+
+    if (list != NULL){
+        cursor.current = list->tail;
+        cursor.index = list->length - 1;
+    }
+
+    return cursor;
+}
+
+ll_cursor llcursor_at(const linked_list* list, ssize_t index){
+    ll_cursor cursor = { llget_node(list, index), index };
+
+    // out of range indexes are clamped to the matching side of the list
+    if (cursor.current == NULL) cursor.index = (index < 0 || list == NULL ? -1 : list->length);
+
+    return cursor;
+}
+
+int llcursor_valid(const ll_cursor* cursor){
+    return (cursor != NULL && cursor->current != NULL);
+}
+
+int llcursor_next(ll_cursor* cursor){
+    if (!llcursor_valid(cursor)) return -1;
+
+    cursor->current = cursor->current->next;
+    cursor->index++;
+
+    return (cursor->current == NULL ? -1 : 0);
+}
+
+int llcursor_prev(ll_cursor* cursor){
+    if (!llcursor_valid(cursor)) return -1;
+
+    cursor->current = cursor->current->prev;
+    cursor->index--;
+
+    return (cursor->current == NULL ? -1 : 0);
+}
+
+void* llcursor_get(const ll_cursor* cursor){
+    if (!llcursor_valid(cursor)) return NULL;
+
+    return cursor->current->value;
+}
+
+int llcursor_set(ll_cursor* cursor, void* element, void (*free_element)(void*)){
+    if (!llcursor_valid(cursor) || element == NULL) return -1;
+
+    if (free_element != NULL) free_element(cursor->current->value);
+
+    cursor->current->value = element;
+
+    return 0;
+}
+
+int llcursor_insert_after(linked_list* list, ll_cursor* cursor, void* element){
+    if (list == NULL || !llcursor_valid(cursor) || element == NULL) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    node* newnode = alloc_node(list, element);
+
+    if (newnode == NULL) return -1;
+
+    node* prenode = cursor->current;
+
+    newnode->prev = prenode;
+    newnode->next = prenode->next;
+
+    if (prenode->next != NULL) prenode->next->prev = newnode;
+    else list->tail = newnode;
+
+    prenode->next = newnode;
+    list->length++;
+    DS_STAT_PEAK(list, peak_length, list->length);
+
+    return 0;
+}
+
+int llcursor_insert_before(linked_list* list, ll_cursor* cursor, void* element){
+    if (list == NULL || cursor == NULL || element == NULL) return -1;
+
+    // off the list is only meaningful past the tail, where inserting before the end appends
+    if (cursor->current == NULL && cursor->index != list->length) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    node* newnode = alloc_node(list, element);
+
+    if (newnode == NULL) return -1;
+
+    node* postnode = cursor->current;
+    node* prenode = (postnode == NULL ? list->tail : postnode->prev);
+
+    newnode->prev = prenode;
+    newnode->next = postnode;
+
+    if (prenode != NULL) prenode->next = newnode;
+    else list->head = newnode;
+
+    if (postnode != NULL) postnode->prev = newnode;
+    else list->tail = newnode;
+
+    list->length++;
+    DS_STAT_PEAK(list, peak_length, list->length);
+    cursor->index++;
+
+    return 0;
+}
+
+int llcursor_delete(linked_list* list, ll_cursor* cursor, void (*free_element)(void*)){
+    if (list == NULL || !llcursor_valid(cursor)) return -1;
+
+    DS_STAT_ADD(list, operations, 1);
+
+    node* deleted_node = cursor->current;
+
+    if (deleted_node->prev != NULL) deleted_node->prev->next = deleted_node->next;
+    else list->head = deleted_node->next;
+
+    if (deleted_node->next != NULL) deleted_node->next->prev = deleted_node->prev;
+    else list->tail = deleted_node->prev;
+
+    // the following element slides into the deleted one's index
+    cursor->current = deleted_node->next;
+
     if (free_element != NULL) free_element(deleted_node->value);
-    free(deleted_node);
+    release_node(list, deleted_node);
     list->length--;
 
     return 0;
 }
+
+// ----------------- stats -----------------
+
+int llget_stats(const linked_list* list, ds_stats* out){
+    if (out == NULL) return -1;
+
+#ifdef DS_STATS
+    if (list == NULL){
+        *out = (ds_stats){0};
+        return -1;
+    }
+
+    DS_STAT_COPY(list, out);
+
+    return 0;
+#else
+    (void)list;
+    *out = (ds_stats){0};
+
+    return -1;
+#endif
+}
+
+int llreset_stats(linked_list* list){
+    if (list == NULL) return -1;
+
+#ifdef DS_STATS
+    DS_STAT_RESET(list, list->length, 0);
+
+    return 0;
+#else
+    return -1;
+#endif
+}
@@ -1,17 +1,22 @@
 #pragma once
 
 #include <sys/types.h>
+#include "ds_stats.h"
+#include "ds_allocator.h"
 
 /**
- * @brief Node structure for linked list.
+ * @brief Node structure for (doubly) linked list.
  */
 struct node {
     void* value;         /**< Pointer to the data stored in the node */
     struct node* next;   /**< Pointer to the next node in the list */
+    struct node* prev;   /**< Pointer to the previous node in the list */
 };
 
 typedef struct node node;
 
+struct node_pool;
+
 /**
  * @brief Linked list structure.
  */
@@ -19,8 +24,22 @@ typedef struct linked_list {
     node* head;          /**< Pointer to the first node */
     node* tail;          /**< Pointer to the last node */
     ssize_t length;      /**< Number of elements in the list */
+    struct node_pool* pool; /**< Pool the nodes are taken from, NULL when nodes are malloc'ed one by one */
+    int owns_pool;       /**< Non-zero when the pool was created by (and is freed with) the list */
+    const ds_allocator* allocator; /**< Allocator for the struct, the nodes and a private pool */
+    DS_STATS_MEMBER      /**< Cost counters, only with DS_STATS (see ds_stats.h) */
 } linked_list;
 
+/**
+ * @brief Cursor over a linked list, a position that can be moved and edited at in O(1).
+ * @note a cursor is a plain value: copy it freely, it owns nothing. once it walks off either end it stays off the list, start again with llcursor_begin or llcursor_last.
+ * @note edits through other cursors or the index based functions may leave a cursor pointing at a freed node or holding a stale index.
+ */
+typedef struct ll_cursor {
+    node* current;       /**< Node under the cursor, NULL when the cursor is off the list */
+    ssize_t index;       /**< Index of the node under the cursor (-1 before the head, length past the tail) */
+} ll_cursor;
+
 /**
  * @brief Create a new node.
  * @param element Pointer to the data to store in the node (can't be NULL).
@@ -28,12 +47,44 @@ typedef struct linked_list {
  */
 node *create_node(void* element);
 
+/**
+ * @brief Create a new node allocated from an allocator.
+ * @param element Pointer to the data to store in the node (can't be NULL).
+ * @param allocator Allocator to use (NULL for malloc), release the node with its free and sizeof(node).
+ * @return Pointer to the newly created node, or NULL on failure.
+ */
+node *create_node_with(void* element, const ds_allocator* allocator);
+
 /**
  * @brief Create an empty linked list.
  * @return Pointer to the newly created linked list, -1 failure.
  */
 linked_list *create_linked_list();
 
+/**
+ * @brief Create an empty linked list whose struct and nodes come from an allocator.
+ * @param allocator Allocator to use (NULL for malloc), it must outlive the list.
+ * @return Pointer to the newly created linked list, or NULL on failure.
+ */
+linked_list *create_linked_list_with(const ds_allocator* allocator);
+
+/**
+ * @brief Create an empty linked list whose nodes are taken from a node pool.
+ * @param pool Pointer to a pool shared with other lists, or NULL to give the list its own private pool.
+ * @note a shared pool must outlive every list using it. when the list owns its pool, freeing the list releases whole slabs instead of freeing every node.
+ * @return Pointer to the newly created linked list, or NULL on failure.
+ */
+linked_list *create_pooled_linked_list(struct node_pool *pool);
+
+/**
+ * @brief Create an empty pooled linked list whose struct (and private pool) come from an allocator.
+ * @param pool Pointer to a pool shared with other lists, or NULL to give the list its own private pool.
+ * @param allocator Allocator to use (NULL for malloc), it must outlive the list.
+ * @note see create_pooled_linked_list. a shared pool keeps allocating from its own allocator.
+ * @return Pointer to the newly created linked list, or NULL on failure.
+ */
+linked_list *create_pooled_linked_list_with(struct node_pool *pool, const ds_allocator* allocator);
+
 /**
  * @brief Free the linked list and its nodes.
  * @param list Pointer to the linked list.
@@ -70,6 +121,7 @@ void llreverse(linked_list *list);
  * @brief Get the node at a specific index.
  * @param list Pointer to the linked list.
  * @param index Index of the node to retrieve.
+ * @note the walk starts from whichever end of the list is closer to the index, so the first and last nodes are reached in O(1).
  * @return Pointer to the node, or NULL if index is out of range.
  */
 node *llget_node(const linked_list *list, ssize_t index);
@@ -110,10 +162,33 @@ int llappend(linked_list *list, void* element);
  */
 int lladd(linked_list *list, ssize_t index, void* element);
 
+/**
+ * @brief Insert several elements at a specific index.
+ * @param list Pointer to the linked list.
+ * @param index Index at which to insert the first element.
+ * @param elements Array of element pointers to insert, in order (none of them can be NULL).
+ * @param count Number of elements in the array.
+ * @note the list is walked to the index once for the whole batch. nothing is inserted on failure.
+ * @return 0 on success, -1 on failure.
+ */
+int lladd_range(linked_list *list, ssize_t index, void** elements, ssize_t count);
+
+/**
+ * @brief Delete count consecutive elements starting at a specific index.
+ * @param list Pointer to the linked list.
+ * @param index Index of the first element to delete.
+ * @param count Number of elements to delete (index + count must not pass the end of the list).
+ * @param free_element Function pointer to free the elements (can be NULL).
+ * @note the list is walked to the index once for the whole batch. memory ownership rules in free_list apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int lldelete_range(linked_list *list, ssize_t index, ssize_t count, void (*free_element)(void*));
+
 /**
  * @brief Remove the last element from the list.
  * @param list Pointer to the linked list.
  * @param free_element Function pointer to free the element (can be NULL).
+ * @note runs in O(1) since the tail links back to its predecessor.
  * @note memory ownership rules in free_list apply here.
  * @return 0 on success, -1 on failure.
  */
@@ -129,3 +204,114 @@ int llpop(linked_list *list, void (*free_element)(void*));
  */
 int lldelete(linked_list *list, ssize_t index, void (*free_element)(void*));
 
+
+/**
+ * @brief Get a cursor on the first element of the list.
+ * @param list Pointer to the linked list.
+ * @note on an empty (or NULL) list the cursor is already past the end.
+ * @return The cursor.
+ */
+ll_cursor llcursor_begin(const linked_list *list);
+
+/**
+ * @brief Get a cursor on the last element of the list, for walking it backwards.
+ * @param list Pointer to the linked list.
+ * @return The cursor, off the list when the list is empty.
+ */
+ll_cursor llcursor_last(const linked_list *list);
+
+/**
+ * @brief Get a cursor on the element at a specific index.
+ * @param list Pointer to the linked list.
+ * @param index Index of the element.
+ * @note costs one llget_node walk, every move from there is O(1).
+ * @return The cursor, off the list when the index is out of range.
+ */
+ll_cursor llcursor_at(const linked_list *list, ssize_t index);
+
+/**
+ * @brief Check whether the cursor is on an element.
+ * @param cursor Pointer to the cursor.
+ * @return 1 when the cursor is on an element, 0 otherwise.
+ */
+int llcursor_valid(const ll_cursor *cursor);
+
+/**
+ * @brief Move the cursor to the next element.
+ * @param cursor Pointer to the cursor.
+ * @return 0 when the cursor landed on an element, -1 when it is now (or already was) off the list.
+ */
+int llcursor_next(ll_cursor *cursor);
+
+/**
+ * @brief Move the cursor to the previous element.
+ * @param cursor Pointer to the cursor.
+ * @return 0 when the cursor landed on an element, -1 when it is now (or already was) off the list.
+ */
+int llcursor_prev(ll_cursor *cursor);
+
+/**
+ * @brief Get the element under the cursor.
+ * @param cursor Pointer to the cursor.
+ * @return Pointer to the element, or NULL if the cursor is off the list.
+ */
+void *llcursor_get(const ll_cursor *cursor);
+
+/**
+ * @brief Replace the element under the cursor.
+ * @param cursor Pointer to the cursor.
+ * @param element Pointer to the new element (can't be NULL).
+ * @param free_element Function pointer to free the old element (can be NULL).
+ * @note memory ownership rules in llset apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int llcursor_set(ll_cursor *cursor, void* element, void (*free_element)(void*));
+
+/**
+ * @brief Insert an element right after the cursor, in O(1).
+ * @param list Pointer to the linked list the cursor walks.
+ * @param cursor Pointer to the cursor (must be on an element), it stays on the same element.
+ * @param element Pointer to the element to insert (can't be NULL).
+ * @return 0 on success, -1 on failure.
+ */
+int llcursor_insert_after(linked_list *list, ll_cursor *cursor, void* element);
+
+/**
+ * @brief Insert an element right before the cursor, in O(1).
+ * @param list Pointer to the linked list the cursor walks.
+ * @param cursor Pointer to the cursor, it stays on the same element (whose index grows by one).
+ * @param element Pointer to the element to insert (can't be NULL).
+ * @note a cursor past the end appends, so this is also how to fill an empty list through a cursor.
+ * @return 0 on success, -1 on failure.
+ */
+int llcursor_insert_before(linked_list *list, ll_cursor *cursor, void* element);
+
+/**
+ * @brief Delete the element under the cursor, in O(1).
+ * @param list Pointer to the linked list the cursor walks.
+ * @param cursor Pointer to the cursor (must be on an element), it moves to the following element.
+ * @param free_element Function pointer to free the element (can be NULL).
+ * @note since the cursor lands on the next element with the same index, deleting while scanning forward needs no extra llcursor_next.
+ * @note memory ownership rules in free_list apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int llcursor_delete(linked_list *list, ll_cursor *cursor, void (*free_element)(void*));
+
+// ----------------- stats -----------------
+
+/**
+ * @brief Copy out the cost counters of the list.
+ * @param list Pointer to the linked list.
+ * @param out Pointer receiving the counters.
+ * @note only available when the library is built with DS_STATS, see ds_stats.h. traversal_steps counts the nodes walked by llget_node (and so by every index based function) and by llget_index.
+ * @return 0 on success, -1 on failure or when the counters are compiled out (out is zeroed then).
+ */
+int llget_stats(const linked_list* list, ds_stats* out);
+
+/**
+ * @brief Reset the cost counters of the list.
+ * @param list Pointer to the linked list.
+ * @note the peak length restarts from the current length.
+ * @return 0 on success, -1 on failure or when the counters are compiled out.
+ */
+int llreset_stats(linked_list* list);
@@ -0,0 +1,298 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE     // mremap
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include "mapped_list.h"
+
+#define MAPPED_LIST_MAGIC "DSMLIST\x01"
+
+// address of the slot at index
+#define SLOT(list, index) ((char*)(list)->arr + (size_t)(index) * (size_t)(list)->element_size)
+
+// file size needed for capacity elements, 0 when it doesn't fit in an off_t
+static size_t file_size_for(ssize_t element_size, ssize_t capacity){
+    size_t max_bytes = (size_t)(((uint64_t)1 << (sizeof(off_t) * 8 - 1)) - 1);
+
+    if ((size_t)capacity > (max_bytes - sizeof(mapped_list_header)) / (size_t)element_size) return 0;
+
+    return sizeof(mapped_list_header) + (size_t)capacity * (size_t)element_size;
+}
+
+static void attach_mapping(mapped_list* list, void* map, size_t map_size){
+    list->header = map;
+    list->arr = (char*)map + sizeof(mapped_list_header);
+    list->map_size = map_size;
+}
+
+// undo a file size change on a path that is failing anyway, so an error here has nowhere to go
+static void truncate_back(int fd, size_t size){
+    int result = ftruncate(fd, (off_t)size);
+    (void)result;
+}
+
+mapped_list* open_mapped_list(const char* path, ssize_t element_size, ssize_t array_size){
+    if (path == NULL || element_size <= 0) return NULL;
+
+    mapped_list* list = malloc(sizeof(mapped_list));
+
+    if (list == NULL) return NULL;
+
+    list->fd = open(path, O_RDWR | O_CREAT, 0644);
+
+    if (list->fd == -1){
+        free(list);
+        return NULL;
+    }
+
+    struct stat st;
+    int fresh = 0;
+    if (fstat(list->fd, &st) == -1) goto fail;
+
+    fresh = (st.st_size == 0);
+    size_t map_size;
+
+    if (fresh){
+        // check if init_size is specified, if it <= 0 a default size of 10 is used
+        ssize_t size = (array_size > 0 ? array_size : 10);
+        map_size = file_size_for(element_size, size);
+        if (map_size == 0 || ftruncate(list->fd, (off_t)map_size) == -1) goto fail;
+    } else {
+        if ((size_t)st.st_size < sizeof(mapped_list_header)) goto fail;
+        map_size = (size_t)st.st_size;
+    }
+
+    void* map = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, list->fd, 0);
+    if (map == MAP_FAILED) goto fail;
+
+    attach_mapping(list, map, map_size);
+
+    if (fresh){
+        memset(list->header, 0, sizeof(mapped_list_header));
+        memcpy(list->header->magic, MAPPED_LIST_MAGIC, sizeof(list->header->magic));
+        list->header->element_size = (uint64_t)element_size;
+        list->header->max_size = (uint64_t)((map_size - sizeof(mapped_list_header)) / (size_t)element_size);
+    }
+
+    // reject files of another format or element size, and headers the file is too short for
+    mapped_list_header* header = list->header;
+    if (memcmp(header->magic, MAPPED_LIST_MAGIC, sizeof(header->magic)) != 0 ||
+        header->element_size != (uint64_t)element_size ||
+        header->length > header->max_size ||
+        file_size_for(element_size, (ssize_t)header->max_size) == 0 ||
+        file_size_for(element_size, (ssize_t)header->max_size) > map_size){
+        munmap(map, map_size);
+        goto fail;
+    }
+
+    list->element_size = element_size;
+    list->length = (ssize_t)header->length;
+    list->max_size = (ssize_t)header->max_size;
+
+    return list;
+
+fail:
+    // leave a file this call created empty, not sized with a zeroed header every later open would reject
+    if (fresh) truncate_back(list->fd, 0);
+    close(list->fd);
+    free(list);
+    return NULL;
+}
+
+int mlsync(mapped_list *list){
+    if (list == NULL) return -1;
+
+    return (msync(list->header, list->map_size, MS_SYNC) == 0 ? 0 : -1);
+}
+
+int close_mapped_list(mapped_list *list){
+    if (list == NULL) return -1;
+
+    int success = mlsync(list);
+
+    if (munmap(list->header, list->map_size) == -1) success = -1;
+    if (close(list->fd) == -1) success = -1;
+    free(list);
+
+    return success;
+}
+
+// keep the header in the file in step with the in-memory length
+static void set_length(mapped_list* list, ssize_t length){
+    list->length = length;
+    // the slots written so far reach the mapping before the length covering them (compiler and CPU alike)
+    atomic_thread_fence(memory_order_release);
+    list->header->length = (uint64_t)length;
+}
+
+// double the file and the mapping
+static int resize_mapped_list(mapped_list* list){
+    if (list->max_size > SSIZE_MAX / 2) return -1;
+
+    ssize_t new_max = list->max_size * 2;
+    size_t new_size = file_size_for(list->element_size, new_max);
+
+    if (new_size == 0) return -1;
+    if (ftruncate(list->fd, (off_t)new_size) == -1) return -1;
+
+#ifdef MREMAP_MAYMOVE
+    void* map = mremap(list->header, list->map_size, new_size, MREMAP_MAYMOVE);
+#else
+    void* map = mmap(NULL, new_size, PROT_READ | PROT_WRITE, MAP_SHARED, list->fd, 0);
+    if (map != MAP_FAILED) munmap(list->header, list->map_size);
+#endif
+
+    if (map == MAP_FAILED){
+        // give the file its old size back so it still matches the header
+        truncate_back(list->fd, list->map_size);
+        return -1;
+    }
+
+    attach_mapping(list, map, new_size);
+    list->max_size = new_max;
+    list->header->max_size = (uint64_t)new_max;
+
+    return 0;
+}
+
+ssize_t mlget_index(const mapped_list *list, const void* element, int (*compare) (void*, void*)){
+    if (list == NULL || element == NULL) return -1;
+
+    for (ssize_t i = 0; i < list->length; i++){
+        if (compare != NULL){
+            if (compare(SLOT(list, i), (void*)element) == 0) return i;
+        } else if (memcmp(SLOT(list, i), element, list->element_size) == 0){
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+void mlprint(const mapped_list *list, void (*print_element) (void*)){
+    if (list == NULL || list->length == 0 || print_element == NULL) {
+        printf("[]\n");
+        return;
+    }
+
+    printf("[");
+
+    for (ssize_t i = 0; i < list->length; i++){
+        print_element(SLOT(list, i));
+        printf(", ");
+    }
+
+    printf("\b\b]\n");
+}
+
+void mlreverse(mapped_list *list){
+    if (list == NULL) return;
+
+    ssize_t index1 = 0, index2 = list->length - 1;
+    char chunk[256];
+
+    while (index1 < index2){
+        char* a = SLOT(list, index1);
+        char* b = SLOT(list, index2);
+
+        // swap through a small buffer so any element size works without an allocation
+        for (size_t done = 0; done < (size_t)list->element_size; done += sizeof(chunk)){
+            size_t n = (size_t)list->element_size - done;
+            if (n > sizeof(chunk)) n = sizeof(chunk);
+            memcpy(chunk, a + done, n);
+            memcpy(a + done, b + done, n);
+            memcpy(b + done, chunk, n);
+        }
+
+        index1++;
+        index2--;
+    }
+}
+
+void* mlat(const mapped_list *list, ssize_t index){
+    if (list == NULL || index < 0 || index >= list->length) return NULL;
+
+    return SLOT(list, index);
+}
+
+int mlget(const mapped_list *list, ssize_t index, void* out){
+    if (list == NULL || out == NULL || index < 0 || index >= list->length) return -1;
+
+    memcpy(out, SLOT(list, index), list->element_size);
+
+    return 0;
+}
+
+int mlset(mapped_list *list, ssize_t index, const void* element){
+    if (list == NULL || element == NULL || index < 0 || index >= list->length) return -1;
+
+    memcpy(SLOT(list, index), element, list->element_size);
+
+    return 0;
+}
+
+int mlappend(mapped_list *list, const void* element){
+    if (list == NULL || element == NULL) return -1;
+    return mladd(list, list->length, element);
+}
+
+// byte offset of element inside the stored values, or -1 when it points elsewhere
+static ssize_t offset_in_list(const mapped_list* list, const void* element){
+    uintptr_t begin = (uintptr_t)list->arr, address = (uintptr_t)element;
+
+    if (address < begin || address >= begin + (size_t)list->length * (size_t)list->element_size) return -1;
+
+    return (ssize_t)(address - begin);
+}
+
+int mladd(mapped_list *list, ssize_t index, const void* element){
+    if (list == NULL || element == NULL || index < 0 || index > list->length) return -1;
+
+    // a value taken from the list itself (e.g. mlat) must be found again after the mapping moves
+    ssize_t offset = offset_in_list(list, element);
+
+    if (list->length >= list->max_size)
+        if (resize_mapped_list(list) == -1) return -1;
+
+    memmove(SLOT(list, index + 1), SLOT(list, index), (size_t)(list->length - index) * list->element_size);
+
+    if (offset != -1){
+        if (offset >= index * list->element_size) offset += list->element_size;
+        element = (char*)list->arr + offset;
+    }
+
+    memcpy(SLOT(list, index), element, list->element_size);
+
+    // the length is published last, so a process crash during an append never exposes an unwritten slot.
+    // an insert before the end shifts the tail first and isn't crash atomic. none of it survives a power
+    // loss without mlsync, the page cache writes pages back in no particular order
+    set_length(list, list->length + 1);
+
+    return 0;
+}
+
+int mlpop(mapped_list *list, void* out){
+    if (list == NULL || list->length <= 0) return -1;
+    return mldelete(list, list->length - 1, out);
+}
+
+int mldelete(mapped_list *list, ssize_t index, void* out){
+    if (list == NULL || index < 0 || index >= list->length) return -1;
+
+    if (out != NULL) memcpy(out, SLOT(list, index), list->element_size);
+
+    memmove(SLOT(list, index), SLOT(list, index + 1), (size_t)(list->length - 1 - index) * list->element_size);
+    set_length(list, list->length - 1);
+
+    return 0;
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <stdint.h>
+#include <sys/types.h>
+
+/**
+ * @brief Header stored at the start of a mapped list file.
+ * @note padded to 64 bytes so the elements that follow it stay aligned.
+ */
+typedef struct {
+    char magic[8];           /**< "DSMLIST" plus a format version byte */
+    uint64_t element_size;   /**< Size of one element in bytes */
+    uint64_t length;         /**< Number of elements stored in the file */
+    uint64_t max_size;       /**< Number of elements the file has room for */
+    uint64_t reserved[4];    /**< Zero, kept for later format versions */
+} mapped_list_header;
+
+/**
+ * @brief Value list (fixed-size elements stored inline) living in a memory-mapped file.
+ * @note opening an existing file maps it as is, there is nothing to deserialize: the OS pages elements in on first access, and lists bigger than RAM work out of the page cache.
+ * @note elements are raw bytes in the file, so they must not contain pointers that should survive a restart.
+ */
+typedef struct {
+    ssize_t length;              /**< Number of elements currently in the list (mirrors the header) */
+    ssize_t max_size;            /**< Maximum capacity of the file, in elements */
+    ssize_t element_size;        /**< Size of one element in bytes */
+    void* arr;                   /**< Elements inside the mapping, right after the header */
+    mapped_list_header* header;  /**< Start of the mapping */
+    size_t map_size;             /**< Size of the mapping (and of the file) in bytes */
+    int fd;                      /**< Descriptor of the backing file */
+} mapped_list;
+
+/**
+ * @brief Open a mapped list file, creating it when it doesn't exist or is empty.
+ * @param path Path of the backing file.
+ * @param element_size Size in bytes of every element (must be > 0, and match the file when it already holds a list).
+ * @param array_size Initial capacity in elements for a new file.
+ * @note if the initial size is <=0 the capacity will be defaulted to 10. the capacity doubles when full, growing the file with ftruncate and the mapping with mremap.
+ * @return Pointer to the opened list, or NULL on failure (including a file that isn't a mapped list or has another element size).
+ */
+mapped_list* open_mapped_list(const char* path, ssize_t element_size, ssize_t array_size);
+
+/**
+ * @brief Checkpoint the list: write every change since the last checkpoint to the file.
+ * @param list Pointer to the mapped list.
+ * @note blocks until the data reached the disk (msync with MS_SYNC). without a checkpoint the changes still reach the file through the page cache, just with no guarantee about when.
+ * @return 0 on success, -1 on failure.
+ */
+int mlsync(mapped_list *list);
+
+/**
+ * @brief Checkpoint the list and close it.
+ * @param list Pointer to the mapped list.
+ * @note the elements stay in the file; reopen it with open_mapped_list.
+ * @return 0 on success, -1 on failure (the list is closed either way).
+ */
+int close_mapped_list(mapped_list *list);
+
+/**
+ * @brief Get the index of an element in the mapped list.
+ * @param list Pointer to the mapped list.
+ * @param element Pointer to a value to find.
+ * @param compare Function pointer to compare two elements (can be NULL).
+ * @note The compare function receives pointers to the values and should return 0 if they match, -1 otherwise. if compare is NULL the values are compared byte by byte.
+ * @return Index of the element, or -1 if not found.
+ */
+ssize_t mlget_index(const mapped_list *list, const void* element, int (*compare) (void*, void*));
+
+/**
+ * @brief Print all elements in the mapped list.
+ * @param list Pointer to the mapped list.
+ * @param print_element Function pointer to print each element, receiving a pointer to it.
+ */
+void mlprint(const mapped_list *list, void (*print_element) (void*));
+
+/**
+ * @brief Reverse the mapped list in place.
+ * @param list Pointer to the mapped list.
+ */
+void mlreverse(mapped_list *list);
+
+/**
+ * @brief Get a pointer to the element stored at a specific index.
+ * @param list Pointer to the mapped list.
+ * @param index Index of the element.
+ * @note the pointer is invalidated by any operation that adds elements (the mapping may move).
+ * @return Pointer to the element inside the mapping, or NULL if index is out of range.
+ */
+void *mlat(const mapped_list *list, ssize_t index);
+
+/**
+ * @brief Copy out the element at a specific index.
+ * @param list Pointer to the mapped list.
+ * @param index Index of the element to retrieve.
+ * @param out Pointer to element_size bytes receiving the value.
+ * @return 0 on success, -1 on failure.
+ */
+int mlget(const mapped_list *list, ssize_t index, void* out);
+
+/**
+ * @brief Overwrite the element at a specific index.
+ * @param list Pointer to the mapped list.
+ * @param index Index of the element to set.
+ * @param element Pointer to the new value (element_size bytes are copied).
+ * @return 0 on success, -1 on failure.
+ */
+int mlset(mapped_list *list, ssize_t index, const void* element);
+
+/**
+ * @brief Append a copy of a value to the end of the list.
+ * @param list Pointer to the mapped list.
+ * @param element Pointer to the value to append (element_size bytes are copied).
+ * @note safe against a process crash: the value reaches the mapping before the length that makes it part of the list. the OS writes pages back in any order, so after a power loss only what the last mlsync checkpointed is reliable.
+ * @return 0 on success, -1 on failure.
+ */
+int mlappend(mapped_list *list, const void* element);
+
+/**
+ * @brief Add a copy of a value at a specific index.
+ * @param list Pointer to the mapped list.
+ * @param index Index at which to insert the element.
+ * @param element Pointer to the value to add (element_size bytes are copied).
+ * @note element may point into the list itself (e.g. mlat), it is found again if the mapping moves or the value gets shifted.
+ * @note only an append (index == length) is safe against a process crash (see mlappend). before the end the following elements are shifted first, so a crash part way can leave a duplicated element and lose the last one. checkpoint with mlsync before such edits when the file must stay consistent.
+ * @return 0 on success, -1 on failure.
+ */
+int mladd(mapped_list *list, ssize_t index, const void* element);
+
+/**
+ * @brief Remove the last element from the mapped list.
+ * @param list Pointer to the mapped list.
+ * @param out Pointer receiving the removed value (can be NULL).
+ * @return 0 on success, -1 on failure.
+ */
+int mlpop(mapped_list *list, void* out);
+
+/**
+ * @brief Delete the element at a specific index.
+ * @param list Pointer to the mapped list.
+ * @param index Index of the element to delete.
+ * @param out Pointer receiving the removed value (can be NULL).
+ * @note like mladd, only removing the last element is safe against a process crash. before the end the following elements are shifted before the length drops, so a crash part way can leave the last element duplicated.
+ * @return 0 on success, -1 on failure.
+ */
+int mldelete(mapped_list *list, ssize_t index, void* out);
@@ -0,0 +1,169 @@
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <sched.h>
+#include <sys/types.h>
+#include "mpmc_queue.h"
+
+mpmc_queue* create_mpmc_queue(ssize_t capacity){
+    size_t size = 1024;
+    // a power of two (and at least 2, so a full lap is distinguishable from an empty slot)
+    if (capacity >= 2){
+        if ((size_t)capacity > SIZE_MAX / 2 / sizeof(mpmc_slot)) return NULL;
+        size = 2;
+        while (size < (size_t)capacity) size *= 2;
+    }
+
+    // the structure is cache line aligned, which malloc does not guarantee
+    mpmc_queue* qu = aligned_alloc(MPMC_CACHE_LINE, sizeof(mpmc_queue));
+
+    if (qu == NULL) return NULL;
+
+    qu->slots = malloc(sizeof(mpmc_slot) * size);
+
+    if (qu->slots == NULL){
+        free(qu);
+        return NULL;
+    }
+
+    for (size_t i = 0; i < size; i++){
+        atomic_init(&qu->slots[i].sequence, i);
+        atomic_init(&qu->slots[i].value, NULL);
+    }
+
+    atomic_init(&qu->enqueue_pos, 0);
+    atomic_init(&qu->dequeue_pos, 0);
+    qu->mask = size - 1;
+
+    return qu;
+}
+
+static void backoff(unsigned* spins){
+    if (*spins < 64){
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+        (*spins)++;
+        return;
+    }
+    sched_yield();
+}
+
+int mpmc_try_enqueue(mpmc_queue* qu, void* element){
+    if (qu == NULL || element == NULL) return -1;
+
+    size_t pos = atomic_load_explicit(&qu->enqueue_pos, memory_order_relaxed);
+    mpmc_slot* slot;
+
+    for (;;){
+        slot = &qu->slots[pos & qu->mask];
+        size_t seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+        if (diff == 0){
+            // the slot is free for this lap, claim the position
+            if (atomic_compare_exchange_weak_explicit(&qu->enqueue_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (diff < 0){
+            return -1; // the slot still holds the element from the previous lap: full
+        } else {
+            pos = atomic_load_explicit(&qu->enqueue_pos, memory_order_relaxed);
+        }
+    }
+
+    atomic_store_explicit(&slot->value, element, memory_order_relaxed);
+    // hand the slot to the consumer of this position
+    atomic_store_explicit(&slot->sequence, pos + 1, memory_order_release);
+
+    return 0;
+}
+
+int mpmc_enqueue(mpmc_queue* qu, void* element){
+    if (qu == NULL || element == NULL) return -1;
+
+    unsigned spins = 0;
+
+    while (mpmc_try_enqueue(qu, element) == -1)
+        backoff(&spins);
+
+    return 0;
+}
+
+void* mpmc_try_dequeue(mpmc_queue* qu){
+    if (qu == NULL) return NULL;
+
+    size_t pos = atomic_load_explicit(&qu->dequeue_pos, memory_order_relaxed);
+    mpmc_slot* slot;
+
+    for (;;){
+        slot = &qu->slots[pos & qu->mask];
+        size_t seq = atomic_load_explicit(&slot->sequence, memory_order_acquire);
+        intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+        if (diff == 0){
+            // the slot holds the element for this position, claim it
+            if (atomic_compare_exchange_weak_explicit(&qu->dequeue_pos, &pos, pos + 1, memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if (diff < 0){
+            return NULL; // no producer has filled the slot yet: empty
+        } else {
+            pos = atomic_load_explicit(&qu->dequeue_pos, memory_order_relaxed);
+        }
+    }
+
+    void* val = atomic_load_explicit(&slot->value, memory_order_relaxed);
+    // hand the slot to the producer of the next lap
+    atomic_store_explicit(&slot->sequence, pos + qu->mask + 1, memory_order_release);
+
+    return val;
+}
+
+void* mpmc_dequeue(mpmc_queue* qu){
+    if (qu == NULL) return NULL;
+
+    unsigned spins = 0;
+    void* val;
+
+    while ((val = mpmc_try_dequeue(qu)) == NULL)
+        backoff(&spins);
+
+    return val;
+}
+
+void* mpmc_queue_front(mpmc_queue* qu){
+    if (qu == NULL) return NULL;
+
+    size_t pos = atomic_load_explicit(&qu->dequeue_pos, memory_order_acquire);
+    mpmc_slot* slot = &qu->slots[pos & qu->mask];
+
+    if (atomic_load_explicit(&slot->sequence, memory_order_acquire) != pos + 1) return NULL;
+
+    // a consumer may claim the slot and the next lap's producer refill it meanwhile, so the value is
+    // loaded atomically: it is then the element at pos or a later one, never a torn pointer
+    return atomic_load_explicit(&slot->value, memory_order_relaxed);
+}
+
+ssize_t mpmc_queue_size(mpmc_queue* qu){
+    if (qu == NULL) return -1;
+
+    size_t head = atomic_load_explicit(&qu->dequeue_pos, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&qu->enqueue_pos, memory_order_acquire);
+
+    // a consumer may have claimed a position the snapshot of enqueue_pos does not include yet
+    return (tail > head ? (ssize_t)(tail - head) : 0);
+}
+
+int free_mpmc_queue(mpmc_queue* qu, void (*free_element) (void*)){
+    if (qu == NULL) return -1;
+
+    if (free_element != NULL){
+        void* val;
+        while ((val = mpmc_try_dequeue(qu)) != NULL)
+            free_element(val);
+    }
+
+    free(qu->slots);
+    free(qu);
+
+    return 0;
+}
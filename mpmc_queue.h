@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#define MPMC_CACHE_LINE 64
+
+/**
+ * @brief Slot of an mpmc queue: the element and the sequence number telling whose turn it is.
+ */
+typedef struct {
+    atomic_size_t sequence;  /**< Position this slot is ready for (a write when == pos, a read when == pos + 1) */
+    _Atomic(void*) value;    /**< Element stored in the slot, atomic so mpmc_queue_front can read it while the slot is reused */
+} mpmc_slot;
+
+/**
+ * @brief Bounded lock-free queue for any number of producer and consumer threads.
+ * @note every slot carries a sequence number, so producers and consumers only race on their own cursor with a CAS and never on a global lock. positions are never reused within a lap, which rules out ABA.
+ */
+typedef struct {
+    _Alignas(MPMC_CACHE_LINE) atomic_size_t enqueue_pos; /**< Next position claimed by a producer */
+    _Alignas(MPMC_CACHE_LINE) atomic_size_t dequeue_pos; /**< Next position claimed by a consumer */
+    _Alignas(MPMC_CACHE_LINE) mpmc_slot* slots;          /**< Ring of slots */
+    size_t mask;                                         /**< capacity - 1, capacity being a power of two */
+} mpmc_queue;
+
+/**
+ * @brief Create a new multi-producer/multi-consumer queue.
+ * @param capacity Maximum number of elements the queue can hold.
+ * @note if the capacity is <2 it will be defaulted to 1024, otherwise it is rounded up to a power of two. the queue never grows.
+ * @return Pointer to the newly created queue, or NULL on failure.
+ */
+mpmc_queue* create_mpmc_queue(ssize_t capacity);
+
+/**
+ * @brief Enqueue an element if there is room for it.
+ * @param qu Pointer to the queue.
+ * @param element Pointer to the element to enqueue (can't be NULL).
+ * @return 0 on success, -1 if the queue is full or on invalid arguments.
+ */
+int mpmc_try_enqueue(mpmc_queue *qu, void* element);
+
+/**
+ * @brief Enqueue an element, waiting for a consumer to make room if the queue is full.
+ * @param qu Pointer to the queue.
+ * @param element Pointer to the element to enqueue (can't be NULL).
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int mpmc_enqueue(mpmc_queue *qu, void* element);
+
+/**
+ * @brief Dequeue the front element if there is one.
+ * @param qu Pointer to the queue.
+ * @note The memory ownership of the dequeued element is transferred (if it is owned by the queue) to the caller.
+ * @return Pointer to the dequeued element, or NULL if the queue is empty.
+ */
+void* mpmc_try_dequeue(mpmc_queue *qu);
+
+/**
+ * @brief Dequeue the front element, waiting for a producer if the queue is empty.
+ * @param qu Pointer to the queue.
+ * @note The memory ownership of the dequeued element is transferred (if it is owned by the queue) to the caller.
+ * @return Pointer to the dequeued element, or NULL on invalid arguments.
+ */
+void* mpmc_dequeue(mpmc_queue *qu);
+
+/**
+ * @brief Peek at the front element of the queue without removing it.
+ * @param qu Pointer to the queue.
+ * @note No memory ownership is transferred. with concurrent consumers the element may be dequeued (and freed by its new owner) right after the call returns, so the result can only be dereferenced while consumers are known to be idle. racing with them it may also be an element enqueued after the front one.
+ * @return Pointer to the front element, or NULL if the queue is empty.
+ */
+void* mpmc_queue_front(mpmc_queue *qu);
+
+/**
+ * @brief Get the number of elements in the queue.
+ * @param qu Pointer to the queue.
+ * @note while other threads are running the result is only a snapshot.
+ * @return Number of elements, or -1 on invalid arguments.
+ */
+ssize_t mpmc_queue_size(mpmc_queue *qu);
+
+/**
+ * @brief Free the queue and its elements.
+ * @param qu Pointer to the queue.
+ * @param free_element Function pointer to free the elements (can be NULL).
+ * @note must not run concurrently with any producer or consumer. memory ownership rules in free_queue apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int free_mpmc_queue(mpmc_queue *qu, void (*free_element) (void*));
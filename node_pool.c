@@ -0,0 +1,100 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include "node_pool.h"
+
+struct node_slab {
+    struct node_slab* next;
+    node nodes[];
+};
+
+node_pool* create_node_pool(ssize_t slab_size){
+    return create_node_pool_with(slab_size, NULL);
+}
+
+node_pool* create_node_pool_with(ssize_t slab_size, const ds_allocator* allocator){
+    if (allocator == NULL) allocator = ds_default_allocator();
+
+    // refuse slabs whose byte count a size_t can't hold
+    if (slab_size > 0 && (size_t)slab_size > (SIZE_MAX - sizeof(struct node_slab)) / sizeof(node)) return NULL;
+
+    node_pool* pool = allocator->alloc(allocator->ctx, sizeof(node_pool));
+
+    if (pool == NULL) return NULL;
+
+    pool->slabs = NULL;
+    pool->free_nodes = NULL;
+    pool->bump = NULL;
+    pool->bump_end = NULL;
+    pool->slab_size = (slab_size > 0 ? slab_size : 64);
+    pool->in_use = 0;
+    pool->allocator = allocator;
+
+    return pool;
+}
+
+static size_t slab_bytes(const node_pool* pool){
+    return sizeof(struct node_slab) + (size_t)pool->slab_size * sizeof(node);
+}
+
+static int add_slab(node_pool* pool){
+    struct node_slab* slab = pool->allocator->alloc(pool->allocator->ctx, slab_bytes(pool));
+
+    if (slab == NULL) return -1;
+
+    slab->next = pool->slabs;
+    pool->slabs = slab;
+    // nodes are handed out from the slab lazily so a fresh slab is never walked
+    pool->bump = slab->nodes;
+    pool->bump_end = slab->nodes + pool->slab_size;
+
+    return 0;
+}
+
+node* pool_alloc_node(node_pool* pool, void* element){
+    if (pool == NULL || element == NULL) return NULL;
+
+    node* n;
+
+    if (pool->free_nodes != NULL){
+        n = pool->free_nodes;
+        pool->free_nodes = n->next;
+    } else {
+        if (pool->bump == pool->bump_end)
+            if (add_slab(pool) == -1) return NULL;
+        n = pool->bump;
+        pool->bump++;
+    }
+
+    n->value = element;
+    n->next = NULL;
+    n->prev = NULL;
+    pool->in_use++;
+
+    return n;
+}
+
+void pool_free_node(node_pool* pool, node* n){
+    if (pool == NULL || n == NULL) return;
+
+    n->next = pool->free_nodes;
+    pool->free_nodes = n;
+    pool->in_use--;
+}
+
+void free_node_pool(node_pool* pool){
+    if (pool == NULL) return;
+
+    struct node_slab* slab = pool->slabs;
+    struct node_slab* temp_next;
+
+    const ds_allocator* allocator = pool->allocator;
+
+    while (slab != NULL){
+        temp_next = slab->next;
+        allocator->free(allocator->ctx, slab, slab_bytes(pool));
+        slab = temp_next;
+    }
+
+    allocator->free(allocator->ctx, pool, sizeof(node_pool));
+}
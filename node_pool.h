@@ -0,0 +1,60 @@
+#pragma once
+
+#include <sys/types.h>
+#include "linked_list.h"
+#include "ds_allocator.h"
+
+/**
+ * @brief Pool handing out linked list nodes from contiguous slabs.
+ * @note Released nodes are kept on a free list threaded through their next pointer and reused before a new slab is allocated.
+ */
+typedef struct node_pool {
+    struct node_slab* slabs;  /**< Chain of slabs owned by the pool (most recent first) */
+    node* free_nodes;         /**< Free list of released nodes */
+    node* bump;               /**< Next never-used node in the most recent slab */
+    node* bump_end;           /**< One past the last node of the most recent slab */
+    ssize_t slab_size;        /**< Number of nodes carved out of each slab */
+    ssize_t in_use;           /**< Number of nodes currently handed out */
+    const ds_allocator* allocator; /**< Allocator for the struct and the slabs */
+} node_pool;
+
+/**
+ * @brief Create a new node pool.
+ * @param slab_size Number of nodes in each slab.
+ * @note if the slab size is <=0 it will be defaulted to 64 nodes. slabs too big for a size_t byte count are rejected.
+ * @return Pointer to the newly created pool, or NULL on failure.
+ */
+node_pool* create_node_pool(ssize_t slab_size);
+
+/**
+ * @brief Create a new node pool whose struct and slabs come from an allocator.
+ * @param slab_size Number of nodes in each slab.
+ * @param allocator Allocator to use (NULL for malloc), it must outlive the pool.
+ * @note see create_node_pool.
+ * @return Pointer to the newly created pool, or NULL on failure.
+ */
+node_pool* create_node_pool_with(ssize_t slab_size, const ds_allocator* allocator);
+
+/**
+ * @brief Take a node from the pool and initialize it.
+ * @param pool Pointer to the node pool.
+ * @param element Pointer to the data to store in the node (can't be NULL).
+ * @note a new slab is allocated only when the free list and the current slab are both exhausted.
+ * @return Pointer to the node, or NULL on failure.
+ */
+node* pool_alloc_node(node_pool *pool, void* element);
+
+/**
+ * @brief Return a node to the pool.
+ * @param pool Pointer to the node pool the node was taken from.
+ * @param n Pointer to the node to release.
+ * @note the element pointed by the node value is not touched, freeing it is the caller's responsibility.
+ */
+void pool_free_node(node_pool *pool, node *n);
+
+/**
+ * @brief Free the pool and all of its slabs.
+ * @param pool Pointer to the node pool.
+ * @note every node handed out by the pool becomes invalid, so no list may still be using the pool.
+ */
+void free_node_pool(node_pool *pool);
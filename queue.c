@@ -1,15 +1,86 @@
 #include <stdlib.h>
+#include <sys/types.h>
 #include "queue.h"
 #include "linked_list.h"
 
+#define SPILL_MEMORY_BUDGET 1024
+#define SPILL_BUFFER_SIZE 256
+
 queue* create_queue(){
-    queue* qu = malloc(sizeof(queue));
+    return create_queue_backend_with(QUEUE_LINKED_LIST, 0, NULL);
+}
+
+queue* create_queue_with(const ds_allocator* allocator){
+    return create_queue_backend_with(QUEUE_LINKED_LIST, 0, allocator);
+}
+
+queue* create_queue_backend(queue_backend backend, ssize_t init_size){
+    return create_queue_backend_with(backend, init_size, NULL);
+}
+
+queue* create_queue_backend_with(queue_backend backend, ssize_t init_size, const ds_allocator* allocator){
+    // a spilling queue needs its callbacks, see create_spilling_queue
+    if (backend == QUEUE_SPILLING) return NULL;
+    if (allocator == NULL) allocator = ds_default_allocator();
+
+    queue* qu = allocator->alloc(allocator->ctx, sizeof(queue));
 
     if (qu == NULL) return NULL;
 
-    qu->list = create_linked_list();
-    
+    qu->allocator = allocator;
+    qu->backend = backend;
+    qu->list = NULL;
+    qu->ring = NULL;
+    qu->spill = NULL;
+    qu->spill_buffer = NULL;
+    qu->spill_buffer_size = 0;
+
+    if (backend == QUEUE_RING_BUFFER){
+        qu->ring = create_deque_with(init_size, allocator);
+
+        if (qu->ring == NULL){
+            allocator->free(allocator->ctx, qu, sizeof(queue));
+            return NULL;
+        }
+
+        return qu;
+    }
+
+    // the queue owns its list, so nodes come from a private pool released in one go on free_queue
+    qu->list = create_pooled_linked_list_with(NULL, allocator);
+
     if (qu->list==NULL){
+        allocator->free(allocator->ctx, qu, sizeof(queue));
+        return NULL;
+    }
+
+    return qu;
+}
+
+queue* create_spilling_queue(const queue_spill_config* config){
+    if (config == NULL || config->serialize == NULL || config->deserialize == NULL) return NULL;
+
+    queue* qu = malloc(sizeof(queue));
+
+    if (qu == NULL) return NULL;
+
+    qu->allocator = ds_default_allocator();
+    qu->backend = QUEUE_SPILLING;
+    qu->list = NULL;
+    qu->spill_config = *config;
+
+    if (qu->spill_config.memory_budget <= 0) qu->spill_config.memory_budget = SPILL_MEMORY_BUDGET;
+
+    // the ring never grows past the budget, so it is allocated once
+    qu->ring = create_deque(qu->spill_config.memory_budget);
+    qu->spill = create_spill_fifo(config->spill_dir, config->segment_size);
+    qu->spill_buffer = malloc(SPILL_BUFFER_SIZE);
+    qu->spill_buffer_size = SPILL_BUFFER_SIZE;
+
+    if (qu->ring == NULL || qu->spill == NULL || qu->spill_buffer == NULL){
+        free_deque(qu->ring, NULL);
+        free_spill_fifo(qu->spill);
+        free(qu->spill_buffer);
         free(qu);
         return NULL;
     }
@@ -17,9 +88,62 @@ queue* create_queue(){
     return qu;
 }
 
+// serialize element to the back of the spill fifo, then free it
+static int spill_element(queue* qu, void* element){
+    if (element == NULL) return -1;
+
+    ssize_t size = qu->spill_config.serialize(element, qu->spill_buffer, qu->spill_buffer_size);
+    if (size < 0) return -1;
+
+    if ((size_t)size > qu->spill_buffer_size){
+        void* new_buffer = realloc(qu->spill_buffer, (size_t)size);
+        if (new_buffer == NULL) return -1;
+
+        qu->spill_buffer = new_buffer;
+        qu->spill_buffer_size = (size_t)size;
+
+        size = qu->spill_config.serialize(element, qu->spill_buffer, qu->spill_buffer_size);
+        if (size < 0 || (size_t)size > qu->spill_buffer_size) return -1;
+    }
+
+    if (sfpush(qu->spill, qu->spill_buffer, (size_t)size) == -1) return -1;
+
+    if (qu->spill_config.free_element != NULL) qu->spill_config.free_element(element);
+
+    return 0;
+}
+
+// move spilled elements back into the ring, up to the budget
+static int refill_ring(queue* qu){
+    while (qu->spill->count > 0 && qu->ring->length < qu->spill_config.memory_budget){
+        const void* data;
+        ssize_t size = sffront(qu->spill, &data);
+        if (size == -1) return -1;
+
+        void* element = qu->spill_config.deserialize(data, (size_t)size);
+        if (element == NULL) return -1;
+
+        // the ring holds the budget without growing, so this can't fail
+        dqpush_back(qu->ring, element);
+        sfpop(qu->spill);
+    }
+
+    return 0;
+}
+
 int enqueue(queue* qu, void* element){
     if (qu == NULL) return -1;
 
+    if (qu->backend == QUEUE_RING_BUFFER) return dqpush_back(qu->ring, element);
+
+    if (qu->backend == QUEUE_SPILLING){
+        // once something is on disk, later elements must queue up behind it
+        if (qu->spill->count == 0 && qu->ring->length < qu->spill_config.memory_budget)
+            return dqpush_back(qu->ring, element);
+
+        return spill_element(qu, element);
+    }
+
     int success = llappend(qu->list, element);
 
     return success;
@@ -28,7 +152,16 @@ int enqueue(queue* qu, void* element){
 void* dequeue(queue* qu){
     if (qu == NULL) return NULL;
 
-    if (qu->list->head==NULL) return NULL; 
+    if (qu->backend == QUEUE_RING_BUFFER) return dqpop_front(qu->ring);
+
+    if (qu->backend == QUEUE_SPILLING){
+        // read ahead a whole ring of spilled elements at once
+        if (qu->ring->length == 0) refill_ring(qu);
+
+        return dqpop_front(qu->ring);
+    }
+
+    if (qu->list->head==NULL) return NULL;
 
     void* val = qu->list->head->value;
 
@@ -37,19 +170,109 @@ void* dequeue(queue* qu){
     return (success == 0 ? val : NULL);
 }
 
+int enqueue_batch(queue* qu, void** elements, ssize_t count){
+    if (qu == NULL || elements == NULL || count < 0) return -1;
+
+    if (qu->backend == QUEUE_RING_BUFFER) return dqpush_back_many(qu->ring, elements, count);
+
+    if (qu->backend == QUEUE_SPILLING){
+        for (ssize_t i = 0; i < count; i++)
+            if (enqueue(qu, elements[i]) == -1) return -1;
+
+        return 0;
+    }
+
+    return lladd_range(qu->list, qu->list->length, elements, count);
+}
+
+ssize_t dequeue_batch(queue* qu, void** out, ssize_t max_count){
+    if (qu == NULL || out == NULL || max_count < 0) return -1;
+
+    if (qu->backend == QUEUE_RING_BUFFER) return dqpop_front_many(qu->ring, out, max_count);
+
+    if (qu->backend == QUEUE_SPILLING){
+        ssize_t n = 0;
+
+        while (n < max_count){
+            if (qu->ring->length == 0) refill_ring(qu);
+
+            ssize_t got = dqpop_front_many(qu->ring, &out[n], max_count - n);
+            if (got <= 0) break;
+            n += got;
+        }
+
+        return n;
+    }
+
+    ssize_t n = (qu->list->length < max_count ? qu->list->length : max_count);
+    node* current = qu->list->head;
+
+    for (ssize_t i = 0; i < n; i++){
+        out[i] = current->value;
+        current = current->next;
+    }
+
+    if (lldelete_range(qu->list, 0, n, NULL) == -1) return -1;
+
+    return n;
+}
+
 void* queue_front(queue * qu){
     if (qu == NULL) return NULL;
 
-    if (qu->list->head==NULL) return NULL; 
+    if (qu->backend == QUEUE_RING_BUFFER) return dqfront(qu->ring);
+
+    if (qu->backend == QUEUE_SPILLING){
+        if (qu->ring->length == 0) refill_ring(qu);
+
+        return dqfront(qu->ring);
+    }
+
+    if (qu->list->head==NULL) return NULL;
 
     return qu->list->head->value;
 }
 
+int queue_get_stats(queue *qu, ds_stats* out){
+    if (qu == NULL){
+        if (out != NULL) *out = (ds_stats){0};
+        return -1;
+    }
+
+    if (qu->backend == QUEUE_LINKED_LIST) return llget_stats(qu->list, out);
+
+    return dqget_stats(qu->ring, out);
+}
+
+int queue_reset_stats(queue *qu){
+    if (qu == NULL) return -1;
+
+    if (qu->backend == QUEUE_LINKED_LIST) return llreset_stats(qu->list);
+
+    return dqreset_stats(qu->ring);
+}
+
 int free_queue (queue *qu, void (*free_element) (void*)){
     if (qu == NULL) return -1;
 
+    if (qu->backend == QUEUE_RING_BUFFER){
+        int free_ring_success = free_deque(qu->ring, free_element);
+        qu->allocator->free(qu->allocator->ctx, qu, sizeof(queue));
+
+        return free_ring_success;
+    }
+
+    if (qu->backend == QUEUE_SPILLING){
+        int free_ring_success = free_deque(qu->ring, free_element);
+        int free_spill_success = free_spill_fifo(qu->spill);
+        free(qu->spill_buffer);
+        free(qu);
+
+        return (free_ring_success == 0 && free_spill_success == 0 ? 0 : -1);
+    }
+
     int free_list_success = free_linked_list(qu->list, free_element);
-    free(qu);
+    qu->allocator->free(qu->allocator->ctx, qu, sizeof(queue));
 
     return free_list_success;
 }
@@ -1,19 +1,87 @@
 #pragma once
 #include "linked_list.h"
+#include "deque.h"
+#include "spill_fifo.h"
+
+#include <sys/types.h>
+
+/**
+ * @brief Storage used behind the queue API.
+ */
+typedef enum {
+    QUEUE_LINKED_LIST,  /**< Elements are kept in pooled linked list nodes */
+    QUEUE_RING_BUFFER,  /**< Elements are kept in a deque (growable circular array) */
+    QUEUE_SPILLING      /**< Elements are kept in a bounded deque, the overflow is serialized to disk */
+} queue_backend;
+
+/**
+ * @brief Settings of a QUEUE_SPILLING queue.
+ */
+typedef struct {
+    ssize_t memory_budget;  /**< Number of elements kept in memory, later ones are spilled to disk (<= 0 for 1024) */
+    const char* spill_dir;  /**< Directory for the segment files (NULL for /tmp) */
+    size_t segment_size;    /**< Size in bytes of a segment file (0 for 4 MiB) */
+    ssize_t (*serialize) (void* element, void* buffer, size_t capacity);  /**< Writes element into buffer and returns its size, or the size needed if it is larger than capacity (nothing is written then), or -1 on failure */
+    void* (*deserialize) (const void* buffer, size_t size);              /**< Builds a new element from its serialized bytes, or returns NULL on failure */
+    void (*free_element) (void*);                                        /**< Frees an element once it has been spilled (can be NULL) */
+} queue_spill_config;
 
 /**
- * @brief Queue structure built on top of a linked list.
+ * @brief Queue structure built on top of a linked list or a circular array.
  */
 typedef struct{
-    linked_list *list;  /**< Pointer to the underlying linked list storing queue elements */
+    queue_backend backend; /**< Storage selected when the queue was created */
+    const ds_allocator* allocator; /**< Allocator for the struct and the underlying list or deque (malloc for QUEUE_SPILLING) */
+    linked_list *list;  /**< Pointer to the underlying linked list storing queue elements (QUEUE_LINKED_LIST only) */
+    deque *ring;        /**< Pointer to the underlying deque storing queue elements (QUEUE_RING_BUFFER and QUEUE_SPILLING) */
+    spill_fifo *spill;  /**< Serialized elements waiting behind the ring (QUEUE_SPILLING only) */
+    queue_spill_config spill_config; /**< Settings of the spilling queue (QUEUE_SPILLING only) */
+    void* spill_buffer; /**< Scratch buffer elements are serialized into (QUEUE_SPILLING only) */
+    size_t spill_buffer_size; /**< Capacity of spill_buffer */
 } queue;
 
 /**
  * @brief Create a new queue.
+ * @note the nodes of the underlying list are taken from a private node pool instead of being malloc'ed per element.
  * @return Pointer to the newly created queue, or NULL on failure.
  */
 queue* create_queue();
 
+/**
+ * @brief Create a new queue using the given storage.
+ * @param backend Storage to use behind the queue (QUEUE_SPILLING needs create_spilling_queue).
+ * @param init_size Initial capacity hint (only used by QUEUE_RING_BUFFER).
+ * @note if the init_size <= 0 the ring capacity defaults to 16, otherwise it is rounded up to a power of two. the ring doubles when full.
+ * @return Pointer to the newly created queue, or NULL on failure.
+ */
+queue* create_queue_backend(queue_backend backend, ssize_t init_size);
+
+/**
+ * @brief Create a new queue whose struct and storage come from an allocator.
+ * @param allocator Allocator to use (NULL for malloc), it must outlive the queue.
+ * @note see create_queue, the private node pool takes its slabs from the allocator too.
+ * @return Pointer to the newly created queue, or NULL on failure.
+ */
+queue* create_queue_with(const ds_allocator* allocator);
+
+/**
+ * @brief Create a new queue using the given storage, allocated from an allocator.
+ * @param backend Storage to use behind the queue (QUEUE_SPILLING needs create_spilling_queue).
+ * @param init_size Initial capacity hint (only used by QUEUE_RING_BUFFER).
+ * @param allocator Allocator to use (NULL for malloc), it must outlive the queue.
+ * @note see create_queue_backend.
+ * @return Pointer to the newly created queue, or NULL on failure.
+ */
+queue* create_queue_backend_with(queue_backend backend, ssize_t init_size, const ds_allocator* allocator);
+
+/**
+ * @brief Create a new queue that keeps at most a fixed number of elements in memory.
+ * @param config Settings of the queue (serialize and deserialize can't be NULL).
+ * @note while the in-memory ring is full, enqueued elements are serialized and appended to segment files, then freed with config->free_element. dequeue reads them back in order, refilling the whole ring in one go once it runs empty. FIFO order is kept and nothing is dropped.
+ * @return Pointer to the newly created queue, or NULL on failure.
+ */
+queue* create_spilling_queue(const queue_spill_config* config);
+
 /**
  * @brief Enqueue an element at the end of the queue.
  * @param qu Pointer to the queue.
@@ -27,10 +95,32 @@ int enqueue(queue *qu, void* element);
  * @param qu Pointer to the queue.
  * @note The memory ownership of the dequeued element is transferred (if it is owned by the queue) to the caller.
  *       The caller is responsible for freeing it if needed.
- * @return Pointer to the dequeued element, or NULL if the queue is empty.
+ * @note elements that were spilled to disk come back as new objects built by the deserialize callback.
+ * @return Pointer to the dequeued element, or NULL if the queue is empty (or a spilled element can't be read back, it then stays in the queue).
  */
 void* dequeue(queue *qu);
 
+/**
+ * @brief Enqueue several elements at the end of the queue, in order.
+ * @param qu Pointer to the queue.
+ * @param elements Array of element pointers to enqueue (none of them can be NULL).
+ * @param count Number of elements in the array.
+ * @note the ring backend checks its capacity once and copies the batch with at most two memcpy calls; nothing is enqueued on failure.
+ *       the spilling backend enqueues the elements one by one, so on failure the ones before the failing element stay enqueued.
+ * @return 0 on success, -1 on failure.
+ */
+int enqueue_batch(queue *qu, void** elements, ssize_t count);
+
+/**
+ * @brief Dequeue up to max_count elements from the front of the queue.
+ * @param qu Pointer to the queue.
+ * @param out Array receiving the dequeued element pointers in FIFO order.
+ * @param max_count Capacity of the out array.
+ * @note The memory ownership of the dequeued elements is transferred (if it is owned by the queue) to the caller.
+ * @return Number of elements dequeued (0 if the queue is empty), or -1 on failure.
+ */
+ssize_t dequeue_batch(queue *qu, void** out, ssize_t max_count);
+
 /**
  * @brief Peek at the front element of the queue without removing it.
  * @param qu Pointer to the queue.
@@ -39,12 +129,29 @@ void* dequeue(queue *qu);
  */
 void* queue_front(queue *qu);
 
+/**
+ * @brief Copy out the cost counters of the queue.
+ * @param qu Pointer to the queue.
+ * @param out Pointer receiving the counters.
+ * @note the counters are the ones of the underlying linked list or deque, see llget_stats and dqget_stats. elements spilled to disk are not counted in the deque's length.
+ * @return 0 on success, -1 on failure or when the counters are compiled out.
+ */
+int queue_get_stats(queue *qu, ds_stats* out);
+
+/**
+ * @brief Reset the cost counters of the queue.
+ * @param qu Pointer to the queue.
+ * @return 0 on success, -1 on failure or when the counters are compiled out.
+ */
+int queue_reset_stats(queue *qu);
+
 /**
  * @brief Free the queue and its elements.
  * @param qu Pointer to the queue.
  * @param free_element Function pointer to free the elements (can be NULL).
  * @note If the queue owns the memory of its elements, pass a valid free_element function; 
  *       otherwise, pass NULL to avoid freeing memory not owned by the queue.
+ * @note elements spilled to disk are discarded together with their segment files.
  * @return 0 on success, -1 on failure.
  */
 int free_queue(queue *qu, void (*free_element) (void*));
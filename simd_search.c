@@ -0,0 +1,144 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/types.h>
+#include "simd_search.h"
+
+#if (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__))) && defined(__GNUC__)
+#define SIMD_SEARCH_X86 1
+#include <immintrin.h>
+#endif
+
+// keys are read through memcpy since they may be stored as other types of the same width (pointers)
+static ssize_t find_u32_scalar(const char* keys, ssize_t from, ssize_t count, uint32_t key){
+    for (ssize_t i = from; i < count; i++){
+        uint32_t value;
+        memcpy(&value, keys + i * sizeof(uint32_t), sizeof(uint32_t));
+        if (value == key) return i;
+    }
+    return -1;
+}
+
+static ssize_t find_u64_scalar(const char* keys, ssize_t from, ssize_t count, uint64_t key){
+    for (ssize_t i = from; i < count; i++){
+        uint64_t value;
+        memcpy(&value, keys + i * sizeof(uint64_t), sizeof(uint64_t));
+        if (value == key) return i;
+    }
+    return -1;
+}
+
+#ifdef SIMD_SEARCH_X86
+
+// movemask gives one bit per byte, so the first set bit divided by the key width is the lane
+
+static ssize_t find_u32_sse2(const char* keys, ssize_t count, uint32_t key){
+    __m128i needle = _mm_set1_epi32((int)key);
+    ssize_t i = 0;
+
+    for (; i + 4 <= count; i += 4){
+        __m128i block = _mm_loadu_si128((const __m128i*)(keys + i * 4));
+        int mask = _mm_movemask_epi8(_mm_cmpeq_epi32(block, needle));
+        if (mask != 0) return i + __builtin_ctz((unsigned)mask) / 4;
+    }
+
+    return find_u32_scalar(keys, i, count, key);
+}
+
+static ssize_t find_u64_sse2(const char* keys, ssize_t count, uint64_t key){
+    __m128i needle = _mm_set1_epi64x((long long)key);
+    ssize_t i = 0;
+
+    for (; i + 2 <= count; i += 2){
+        __m128i block = _mm_loadu_si128((const __m128i*)(keys + i * 8));
+        // no 64-bit compare before SSE4.1: both 32-bit halves of a lane have to match
+        __m128i eq = _mm_cmpeq_epi32(block, needle);
+        eq = _mm_and_si128(eq, _mm_shuffle_epi32(eq, _MM_SHUFFLE(2, 3, 0, 1)));
+        int mask = _mm_movemask_epi8(eq);
+        if (mask != 0) return i + __builtin_ctz((unsigned)mask) / 8;
+    }
+
+    return find_u64_scalar(keys, i, count, key);
+}
+
+__attribute__((target("avx2")))
+static ssize_t find_u32_avx2(const char* keys, ssize_t count, uint32_t key){
+    __m256i needle = _mm256_set1_epi32((int)key);
+    ssize_t i = 0;
+
+    // two vectors per round keep both load ports busy
+    for (; i + 16 <= count; i += 16){
+        __m256i eq0 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(keys + i * 4)), needle);
+        __m256i eq1 = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(keys + (i + 8) * 4)), needle);
+        __m256i any = _mm256_or_si256(eq0, eq1);
+        if (!_mm256_testz_si256(any, any)){
+            unsigned mask0 = (unsigned)_mm256_movemask_epi8(eq0);
+            if (mask0 != 0) return i + __builtin_ctz(mask0) / 4;
+            return i + 8 + __builtin_ctz((unsigned)_mm256_movemask_epi8(eq1)) / 4;
+        }
+    }
+
+    for (; i + 8 <= count; i += 8){
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(keys + i * 4)), needle));
+        if (mask != 0) return i + __builtin_ctz(mask) / 4;
+    }
+
+    return find_u32_scalar(keys, i, count, key);
+}
+
+__attribute__((target("avx2")))
+static ssize_t find_u64_avx2(const char* keys, ssize_t count, uint64_t key){
+    __m256i needle = _mm256_set1_epi64x((long long)key);
+    ssize_t i = 0;
+
+    for (; i + 8 <= count; i += 8){
+        __m256i eq0 = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(keys + i * 8)), needle);
+        __m256i eq1 = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(keys + (i + 4) * 8)), needle);
+        __m256i any = _mm256_or_si256(eq0, eq1);
+        if (!_mm256_testz_si256(any, any)){
+            unsigned mask0 = (unsigned)_mm256_movemask_epi8(eq0);
+            if (mask0 != 0) return i + __builtin_ctz(mask0) / 8;
+            return i + 4 + __builtin_ctz((unsigned)_mm256_movemask_epi8(eq1)) / 8;
+        }
+    }
+
+    for (; i + 4 <= count; i += 4){
+        unsigned mask = (unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(keys + i * 8)), needle));
+        if (mask != 0) return i + __builtin_ctz(mask) / 8;
+    }
+
+    return find_u64_scalar(keys, i, count, key);
+}
+
+#endif
+
+simd_search_level simd_search_active_level(void){
+#ifdef SIMD_SEARCH_X86
+    if (__builtin_cpu_supports("avx2")) return SIMD_SEARCH_AVX2;
+    return SIMD_SEARCH_SSE2;
+#else
+    return SIMD_SEARCH_SCALAR;
+#endif
+}
+
+ssize_t simd_find_u32(const void* keys, ssize_t count, uint32_t key){
+    if (keys == NULL || count <= 0) return -1;
+
+#ifdef SIMD_SEARCH_X86
+    if (__builtin_cpu_supports("avx2")) return find_u32_avx2((const char*)keys, count, key);
+    return find_u32_sse2((const char*)keys, count, key);
+#else
+    return find_u32_scalar((const char*)keys, 0, count, key);
+#endif
+}
+
+ssize_t simd_find_u64(const void* keys, ssize_t count, uint64_t key){
+    if (keys == NULL || count <= 0) return -1;
+
+#ifdef SIMD_SEARCH_X86
+    if (__builtin_cpu_supports("avx2")) return find_u64_avx2((const char*)keys, count, key);
+    return find_u64_sse2((const char*)keys, count, key);
+#else
+    return find_u64_scalar((const char*)keys, 0, count, key);
+#endif
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+#include <sys/types.h>
+
+/**
+ * @file simd_search.h
+ * @brief Linear search kernels over contiguous keys, shared by array_list and value_list.
+ *
+ * On x86 the kernels compare 4 (SSE2) or 8 (AVX2) 32-bit keys and 2 or 4 64-bit keys per instruction.
+ * AVX2 is picked at runtime when the CPU supports it. Other targets fall back to a plain loop.
+ */
+
+/**
+ * @brief Instruction set used by the search kernels.
+ */
+typedef enum {
+    SIMD_SEARCH_SCALAR, /**< One key per comparison */
+    SIMD_SEARCH_SSE2,   /**< 128-bit compares */
+    SIMD_SEARCH_AVX2    /**< 256-bit compares */
+} simd_search_level;
+
+/**
+ * @brief Get the instruction set the kernels dispatch to on this machine.
+ * @return The level in use.
+ */
+simd_search_level simd_search_active_level(void);
+
+/**
+ * @brief Find the first 32-bit key equal to a given key.
+ * @param keys Pointer to count contiguous 32-bit keys (no alignment needed).
+ * @param count Number of keys.
+ * @param key Key to look for.
+ * @return Index of the first match, or -1 if not found.
+ */
+ssize_t simd_find_u32(const void* keys, ssize_t count, uint32_t key);
+
+/**
+ * @brief Find the first 64-bit key equal to a given key.
+ * @param keys Pointer to count contiguous 64-bit keys (no alignment needed).
+ * @param count Number of keys.
+ * @param key Key to look for.
+ * @return Index of the first match, or -1 if not found.
+ */
+ssize_t simd_find_u64(const void* keys, ssize_t count, uint64_t key);
@@ -0,0 +1,259 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <sys/types.h>
+#include "skip_list.h"
+
+static skip_node* create_skip_node(void* element, int level){
+    skip_node* n = malloc(sizeof(skip_node) + (size_t)level * sizeof(skip_link));
+
+    if (n == NULL) return NULL;
+
+    n->value = element;
+    n->prev = NULL;
+    n->level = level;
+
+    return n;
+}
+
+// one lane more with probability 1/4 each, drawn two bits at a time from a xorshift generator
+static int random_level(skip_list* list){
+    unsigned long long x = list->seed;
+
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    list->seed = x;
+
+    int level = 1;
+    while ((x & 3) == 0 && level < SKIP_LIST_MAX_LEVEL){
+        level++;
+        x >>= 2;
+    }
+
+    return level;
+}
+
+// find on every lane the last node before position index + 1 (the head being position 0) and its position,
+// returns the one on the bottom lane
+static skip_node* find_update(const skip_list* list, ssize_t index, skip_node** update, ssize_t* rank){
+    skip_node* current = list->head;
+    ssize_t position = 0;
+
+    for (int i = list->level - 1; i >= 0; i--){
+        while (current->links[i].next != NULL && position + current->links[i].width <= index){
+            position += current->links[i].width;
+            current = current->links[i].next;
+        }
+        update[i] = current;
+        rank[i] = position;
+    }
+
+    return current;
+}
+
+skip_list* create_skip_list(){
+    skip_list* list = malloc(sizeof(skip_list));
+
+    if (list == NULL) return NULL;
+
+    list->head = create_skip_node(NULL, SKIP_LIST_MAX_LEVEL);
+
+    if (list->head == NULL){
+        free(list);
+        return NULL;
+    }
+
+    list->head->links[0].next = NULL;
+    list->head->links[0].width = 1;
+    list->tail = NULL;
+    list->length = 0;
+    list->level = 1;
+    list->seed = 0x9E3779B97F4A7C15ULL;
+
+    return list;
+}
+
+int free_skip_list(skip_list* list, void (*free_element)(void*)){
+    if (list == NULL) return -1;
+
+    skip_node* delete_pointer = list->head->links[0].next;
+    skip_node* temp_next;
+
+    while (delete_pointer != NULL){
+        temp_next = delete_pointer->links[0].next;
+        if (free_element != NULL) free_element(delete_pointer->value);
+        free(delete_pointer);
+        delete_pointer = temp_next;
+    }
+
+    free(list->head);
+    free(list);
+
+    return 0;
+}
+
+ssize_t slget_index(const skip_list* list, void* element, int (*compare) (void*, void*)){
+    if (list == NULL || element == NULL || compare == NULL) return -1;
+
+    ssize_t index = 0;
+
+    for (skip_node* current = list->head->links[0].next; current != NULL; current = current->links[0].next){
+        if (compare(current->value, element) == 0) return index;
+        index++;
+    }
+
+    return -1;
+}
+
+void slprint(const skip_list* list, void (*print_element) (void*)){
+    if (list == NULL || list->length == 0 || print_element == NULL) {
+        printf("[]\n");
+        return;
+    }
+
+    printf("[");
+
+    for (skip_node* current = list->head->links[0].next; current != NULL; current = current->links[0].next){
+        print_element(current->value);
+        printf(", ");
+    }
+
+    printf("\b\b]\n");
+}
+
+void slreverse(skip_list* list){
+    if (list == NULL || list->length < 2) return;
+
+    skip_node* front = list->head->links[0].next;
+    skip_node* back = list->tail;
+
+    for (ssize_t i = 0; i < list->length / 2; i++){
+        void* temp = front->value;
+        front->value = back->value;
+        back->value = temp;
+
+        front = front->links[0].next;
+        back = back->prev;
+    }
+}
+
+skip_node* slget_node(const skip_list* list, ssize_t index){
+    if (list == NULL || index < 0 || index >= list->length) return NULL;
+
+    if (index == list->length - 1) return list->tail;
+
+    skip_node* current = list->head;
+    ssize_t position = 0;
+
+    for (int i = list->level - 1; i >= 0; i--){
+        while (current->links[i].next != NULL && position + current->links[i].width <= index + 1){
+            position += current->links[i].width;
+            current = current->links[i].next;
+        }
+        if (position == index + 1) break;
+    }
+
+    return current;
+}
+
+void* slget(const skip_list* list, ssize_t index){
+    skip_node* n = slget_node(list, index);
+
+    if (n == NULL) return NULL;
+
+    return n->value;
+}
+
+int slset(skip_list* list, ssize_t index, void* element, void (*free_element) (void*)){
+    if (element == NULL) return -1;
+
+    skip_node* n = slget_node(list, index);
+
+    if (n == NULL) return -1;
+
+    if (free_element != NULL) free_element(n->value);
+
+    n->value = element;
+
+    return 0;
+}
+
+int slappend(skip_list* list, void* element){
+    if (list == NULL) return -1;
+    return sladd(list, list->length, element);
+}
+
+int sladd(skip_list* list, ssize_t index, void* element){
+    if (list == NULL || element == NULL) return -1;
+
+    if (index < 0 || index > list->length) return -1;
+
+    int level = random_level(list);
+    skip_node* n = create_skip_node(element, level);
+
+    if (n == NULL) return -1;
+
+    // new lanes start out as a single link from the head to the end
+    for (int i = list->level; i < level; i++){
+        list->head->links[i].next = NULL;
+        list->head->links[i].width = list->length + 1;
+    }
+    if (level > list->level) list->level = level;
+
+    skip_node* update[SKIP_LIST_MAX_LEVEL];
+    ssize_t rank[SKIP_LIST_MAX_LEVEL];
+    find_update(list, index, update, rank);
+
+    // the links n is on are split in two around position index + 1
+    for (int i = 0; i < level; i++){
+        n->links[i].next = update[i]->links[i].next;
+        n->links[i].width = rank[i] + update[i]->links[i].width - index;
+        update[i]->links[i].next = n;
+        update[i]->links[i].width = index + 1 - rank[i];
+    }
+
+    // the links passing over n now skip one more position
+    for (int i = level; i < list->level; i++) update[i]->links[i].width++;
+
+    n->prev = (update[0] == list->head ? NULL : update[0]);
+    if (n->links[0].next != NULL) n->links[0].next->prev = n;
+    else list->tail = n;
+
+    list->length++;
+
+    return 0;
+}
+
+int slpop(skip_list* list, void (*free_element)(void*)){
+    if (list == NULL) return -1;
+    return sldelete(list, list->length - 1, free_element);
+}
+
+int sldelete(skip_list* list, ssize_t index, void (*free_element)(void*)){
+    if (list == NULL) return -1;
+
+    if (index < 0 || index >= list->length) return -1;
+
+    skip_node* update[SKIP_LIST_MAX_LEVEL];
+    ssize_t rank[SKIP_LIST_MAX_LEVEL];
+    skip_node* n = find_update(list, index, update, rank)->links[0].next;
+
+    // the links ending at n are joined with the ones leaving it, the others skip one position less
+    for (int i = 0; i < n->level; i++){
+        update[i]->links[i].width += n->links[i].width - 1;
+        update[i]->links[i].next = n->links[i].next;
+    }
+    for (int i = n->level; i < list->level; i++) update[i]->links[i].width--;
+
+    if (n->links[0].next != NULL) n->links[0].next->prev = n->prev;
+    else list->tail = n->prev;
+
+    while (list->level > 1 && list->head->links[list->level - 1].next == NULL) list->level--;
+
+    if (free_element != NULL) free_element(n->value);
+    free(n);
+
+    list->length--;
+
+    return 0;
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <sys/types.h>
+
+#ifndef SKIP_LIST_MAX_LEVEL
+/**
+ * @brief Maximum number of lanes of a skip list node.
+ * @note a node reaches level k + 1 with probability 1 / 4^k, so 16 lanes keep lookups logarithmic past 4^16 elements.
+ */
+#define SKIP_LIST_MAX_LEVEL 16
+#endif
+
+struct skip_node;
+
+/**
+ * @brief One lane of a skip list node: the next node on that lane and how many positions it skips.
+ */
+typedef struct skip_link {
+    struct skip_node* next;  /**< Next node with at least this many lanes, NULL at the end of the lane */
+    ssize_t width;           /**< Number of positions between this node and next (counting to one past the last element when next is NULL) */
+} skip_link;
+
+/**
+ * @brief Node structure for indexable skip list.
+ */
+typedef struct skip_node {
+    void* value;             /**< Pointer to the data stored in the node */
+    struct skip_node* prev;  /**< Pointer to the previous node in the list (NULL for the first one) */
+    int level;               /**< Number of lanes the node is on */
+    skip_link links[];       /**< Lanes of the node, links[0] is the plain list order */
+} skip_node;
+
+/**
+ * @brief Indexable skip list structure: a linked list with express lanes recording how many elements each link skips.
+ * @note get, set, add and delete by index are O(log n) expected instead of the O(n) walk of linked_list, for about 1.33 links per element on top of a doubly linked node. the functions mirror the ll* ones so it can replace a linked_list where positional edits dominate.
+ */
+typedef struct skip_list {
+    skip_node* head;         /**< Sentinel on every lane, not an element */
+    skip_node* tail;         /**< Pointer to the last node, NULL when the list is empty */
+    ssize_t length;          /**< Number of elements in the list */
+    int level;               /**< Number of lanes in use */
+    unsigned long long seed; /**< State of the generator drawing node levels */
+} skip_list;
+
+/**
+ * @brief Create an empty skip list.
+ * @return Pointer to the newly created list, or NULL on failure.
+ */
+skip_list *create_skip_list();
+
+/**
+ * @brief Free the list and its nodes.
+ * @param list Pointer to the skip list.
+ * @param free_element Function pointer to free the elements (can be NULL).
+ * @note memory ownership rules in free_linked_list apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int free_skip_list(skip_list *list, void (*free_element)(void*));
+
+/**
+ * @brief Get the index of an element in the list.
+ * @param list Pointer to the skip list.
+ * @param element Pointer to the element to find.
+ * @param compare Function pointer to compare the passed element with the list elements.
+ * @note compare passed function should return 0 on success (the two element match) and -1 on failure. the list isn't ordered by value, so this is a linear scan.
+ * @return Index of the element, or -1 if not found.
+ */
+ssize_t slget_index(const skip_list *list, void* element, int (*compare) (void*, void*));
+
+/**
+ * @brief Print the list.
+ * @param list Pointer to the skip list.
+ * @param print_element Function pointer to print each element.
+ */
+void slprint(const skip_list *list, void (*print_element) (void*));
+
+/**
+ * @brief Reverse the list in place.
+ * @param list Pointer to the skip list.
+ * @note the values are swapped between nodes, the lanes stay as they are.
+ */
+void slreverse(skip_list *list);
+
+/**
+ * @brief Get the node at a specific index.
+ * @param list Pointer to the skip list.
+ * @param index Index of the node to retrieve.
+ * @note O(log n) expected, the first and last nodes are reached in O(1).
+ * @return Pointer to the node, or NULL if index is out of range.
+ */
+skip_node *slget_node(const skip_list *list, ssize_t index);
+
+/**
+ * @brief Get the element at a specific index.
+ * @param list Pointer to the skip list.
+ * @param index Index of the element to retrieve.
+ * @return Pointer to the element, or NULL if index is out of range.
+ */
+void *slget(const skip_list *list, ssize_t index);
+
+/**
+ * @brief Set the element at a specific index.
+ * @param list Pointer to the skip list.
+ * @param index Index of the element to set.
+ * @param element Pointer to the new element.
+ * @param free_element Function pointer to free the old element (can be NULL).
+ * @note the old element will no longer be in the list, so if the list owns it, free it using the provided function; otherwise, pass NULL.
+ * @return 0 on success, -1 on failure.
+ */
+int slset(skip_list *list, ssize_t index, void* element, void (*free_element) (void*));
+
+/**
+ * @brief Append an element to the end of the list.
+ * @param list Pointer to the skip list.
+ * @param element Pointer to the element to append.
+ * @return 0 on success, -1 on failure.
+ */
+int slappend(skip_list *list, void* element);
+
+/**
+ * @brief Add an element at a specific index.
+ * @param list Pointer to the skip list.
+ * @param index Index at which to insert the element.
+ * @param element Pointer to the element to add.
+ * @note O(log n) expected: the node gets a random number of lanes and the widths of the links passing over it grow by one.
+ * @return 0 on success, -1 on failure.
+ */
+int sladd(skip_list *list, ssize_t index, void* element);
+
+/**
+ * @brief Remove the last element from the list.
+ * @param list Pointer to the skip list.
+ * @param free_element Function pointer to free the element (can be NULL).
+ * @note memory ownership rules in free_linked_list apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int slpop(skip_list *list, void (*free_element)(void*));
+
+/**
+ * @brief Delete the element at a specific index.
+ * @param list Pointer to the skip list.
+ * @param index Index of the element to delete.
+ * @param free_element Function pointer to free the element (can be NULL).
+ * @note O(log n) expected, memory ownership rules in free_linked_list apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int sldelete(skip_list *list, ssize_t index, void (*free_element)(void*));
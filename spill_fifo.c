@@ -0,0 +1,257 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include "spill_fifo.h"
+
+#define SPILL_BUFFER_SIZE (64 * 1024)
+#define SPILL_SEGMENT_SIZE (4 * 1024 * 1024)
+
+// every record is stored as a 4 byte length followed by its bytes
+#define RECORD_HEADER sizeof(uint32_t)
+
+// write the path of segment seq into path
+static void segment_path(const spill_fifo* sf, ssize_t seq, char* path, size_t size){
+    snprintf(path, size, "%s/%zd.seg", sf->dir, seq);
+}
+
+spill_fifo* create_spill_fifo(const char* dir, size_t segment_size){
+    if (dir == NULL) dir = "/tmp";
+
+    spill_fifo* sf = malloc(sizeof(spill_fifo));
+
+    if (sf == NULL) return NULL;
+
+    size_t dir_size = strlen(dir) + sizeof("/spill-XXXXXX");
+    sf->dir = malloc(dir_size);
+    sf->write_buf = malloc(SPILL_BUFFER_SIZE);
+    sf->read_buf = malloc(SPILL_BUFFER_SIZE);
+
+    if (sf->dir == NULL || sf->write_buf == NULL || sf->read_buf == NULL) goto fail;
+
+    snprintf(sf->dir, dir_size, "%s/spill-XXXXXX", dir);
+    if (mkdtemp(sf->dir) == NULL) goto fail;
+
+    sf->segment_size = (segment_size > 0 ? segment_size : SPILL_SEGMENT_SIZE);
+    sf->count = 0;
+
+    sf->write_fd = -1;
+    sf->write_seq = 0;
+    sf->write_bytes = 0;
+    sf->write_used = 0;
+    sf->write_cap = SPILL_BUFFER_SIZE;
+
+    sf->read_fd = -1;
+    sf->read_seq = 0;
+    sf->read_pos = 0;
+    sf->read_end = 0;
+    sf->read_cap = SPILL_BUFFER_SIZE;
+
+    return sf;
+
+fail:
+    free(sf->dir);
+    free(sf->write_buf);
+    free(sf->read_buf);
+    free(sf);
+    return NULL;
+}
+
+int free_spill_fifo(spill_fifo *sf){
+    if (sf == NULL) return -1;
+
+    int success = 0;
+
+    if (sf->write_fd != -1 && close(sf->write_fd) == -1) success = -1;
+    if (sf->read_fd != -1 && close(sf->read_fd) == -1) success = -1;
+
+    // segments read_seq..write_seq may still be on disk
+    char path[4096];
+    for (ssize_t seq = sf->read_seq; seq <= sf->write_seq; seq++){
+        segment_path(sf, seq, path, sizeof(path));
+        if (unlink(path) == -1 && errno != ENOENT) success = -1;
+    }
+
+    if (rmdir(sf->dir) == -1) success = -1;
+
+    free(sf->dir);
+    free(sf->write_buf);
+    free(sf->read_buf);
+    free(sf);
+
+    return success;
+}
+
+// write the buffered records to the current segment, opening it on its first flush
+static int flush_writer(spill_fifo* sf){
+    if (sf->write_used == 0) return 0;
+
+    if (sf->write_fd == -1){
+        char path[4096];
+        segment_path(sf, sf->write_seq, path, sizeof(path));
+        sf->write_fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0600);
+        if (sf->write_fd == -1) return -1;
+    }
+
+    size_t done = 0;
+    while (done < sf->write_used){
+        ssize_t n = write(sf->write_fd, sf->write_buf + done, sf->write_used - done);
+        if (n == -1 && errno == EINTR) continue;
+        if (n <= 0){
+            // keep what wasn't written for the next attempt
+            memmove(sf->write_buf, sf->write_buf + done, sf->write_used - done);
+            sf->write_used -= done;
+            return -1;
+        }
+        done += (size_t)n;
+    }
+
+    sf->write_used = 0;
+
+    return 0;
+}
+
+// finish the current segment so the reader can take it, later records go to a new one
+static int rotate_writer(spill_fifo* sf){
+    if (sf->write_bytes == 0) return 0;
+    if (flush_writer(sf) == -1) return -1;
+
+    if (close(sf->write_fd) == -1){
+        sf->write_fd = -1;
+        return -1;
+    }
+
+    sf->write_fd = -1;
+    sf->write_seq++;
+    sf->write_bytes = 0;
+
+    return 0;
+}
+
+int sfpush(spill_fifo *sf, const void* data, size_t size){
+    if (sf == NULL || (data == NULL && size > 0) || size > UINT32_MAX) return -1;
+
+    size_t record = RECORD_HEADER + size;
+
+    // records never span two segments
+    if (sf->write_bytes > 0 && sf->write_bytes + record > sf->segment_size)
+        if (rotate_writer(sf) == -1) return -1;
+
+    if (sf->write_used + record > sf->write_cap){
+        if (flush_writer(sf) == -1) return -1;
+
+        if (record > sf->write_cap){
+            char* new_buf = realloc(sf->write_buf, record);
+            if (new_buf == NULL) return -1;
+            sf->write_buf = new_buf;
+            sf->write_cap = record;
+        }
+    }
+
+    uint32_t length = (uint32_t)size;
+    memcpy(sf->write_buf + sf->write_used, &length, RECORD_HEADER);
+    if (size > 0) memcpy(sf->write_buf + sf->write_used + RECORD_HEADER, data, size);
+
+    sf->write_used += record;
+    sf->write_bytes += record;
+    sf->count++;
+
+    return 0;
+}
+
+// open the next segment to read, taking it from the writer when it is the one being written
+static int open_reader(spill_fifo* sf){
+    if (sf->read_seq == sf->write_seq)
+        if (rotate_writer(sf) == -1) return -1;
+
+    char path[4096];
+    segment_path(sf, sf->read_seq, path, sizeof(path));
+    sf->read_fd = open(path, O_RDONLY);
+    if (sf->read_fd == -1) return -1;
+
+#ifdef POSIX_FADV_SEQUENTIAL
+    posix_fadvise(sf->read_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    return 0;
+}
+
+// drop the segment that was read entirely
+static int close_reader(spill_fifo* sf){
+    char path[4096];
+    segment_path(sf, sf->read_seq, path, sizeof(path));
+
+    int success = close(sf->read_fd);
+    sf->read_fd = -1;
+    sf->read_seq++;
+
+    if (unlink(path) == -1) success = -1;
+
+    return (success == 0 ? 0 : -1);
+}
+
+// make sure at least needed bytes are available at read_pos
+static int fill_reader(spill_fifo* sf, size_t needed){
+    while (sf->read_end - sf->read_pos < needed){
+        // move the leftover to the front, then read ahead as much as fits
+        memmove(sf->read_buf, sf->read_buf + sf->read_pos, sf->read_end - sf->read_pos);
+        sf->read_end -= sf->read_pos;
+        sf->read_pos = 0;
+
+        if (needed > sf->read_cap){
+            char* new_buf = realloc(sf->read_buf, needed);
+            if (new_buf == NULL) return -1;
+            sf->read_buf = new_buf;
+            sf->read_cap = needed;
+        }
+
+        if (sf->read_fd == -1)
+            if (open_reader(sf) == -1) return -1;
+
+        ssize_t n = read(sf->read_fd, sf->read_buf + sf->read_end, sf->read_cap - sf->read_end);
+        if (n == -1 && errno == EINTR) continue;
+        if (n == -1) return -1;
+
+        if (n == 0){
+            // a segment only holds whole records, anything left over means it was truncated
+            if (sf->read_end > 0) return -1;
+            if (close_reader(sf) == -1) return -1;
+            continue;
+        }
+
+        sf->read_end += (size_t)n;
+    }
+
+    return 0;
+}
+
+ssize_t sffront(spill_fifo *sf, const void** data){
+    if (sf == NULL || data == NULL || sf->count == 0) return -1;
+
+    if (fill_reader(sf, RECORD_HEADER) == -1) return -1;
+
+    uint32_t length;
+    memcpy(&length, sf->read_buf + sf->read_pos, RECORD_HEADER);
+
+    if (fill_reader(sf, RECORD_HEADER + (size_t)length) == -1) return -1;
+
+    *data = sf->read_buf + sf->read_pos + RECORD_HEADER;
+
+    return (ssize_t)length;
+}
+
+int sfpop(spill_fifo *sf){
+    const void* data;
+    ssize_t size = sffront(sf, &data);
+
+    if (size == -1) return -1;
+
+    sf->read_pos += RECORD_HEADER + (size_t)size;
+    sf->count--;
+
+    return 0;
+}
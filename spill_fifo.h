@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stddef.h>
+#include <sys/types.h>
+
+/**
+ * @brief FIFO of byte records stored in segment files on disk.
+ * @note records are appended through a write buffer and read back through a read buffer, so the disk only sees large sequential writes and reads. a segment file is deleted as soon as it has been read entirely.
+ */
+typedef struct {
+    char* dir;              /**< Private directory holding the segment files */
+    size_t segment_size;    /**< Size in bytes after which a new segment is started */
+    ssize_t count;          /**< Number of records in the fifo */
+
+    int write_fd;           /**< Descriptor of the segment being written, -1 until its first flush */
+    ssize_t write_seq;      /**< Number of the segment being written */
+    size_t write_bytes;     /**< Bytes appended to the segment being written, buffered ones included */
+    char* write_buf;        /**< Records not yet written to the segment */
+    size_t write_used;      /**< Bytes used in write_buf */
+    size_t write_cap;       /**< Capacity of write_buf */
+
+    int read_fd;            /**< Descriptor of the segment being read, -1 when none is open */
+    ssize_t read_seq;       /**< Number of the segment being read */
+    char* read_buf;         /**< Bytes read ahead from the segment */
+    size_t read_pos;        /**< Offset in read_buf of the front record */
+    size_t read_end;        /**< Bytes of valid data in read_buf */
+    size_t read_cap;        /**< Capacity of read_buf */
+} spill_fifo;
+
+/**
+ * @brief Create a new spill fifo.
+ * @param dir Directory in which a private subdirectory for the segments is created (NULL for /tmp).
+ * @param segment_size Size in bytes after which a new segment file is started.
+ * @note if the segment_size is 0 it defaults to 4 MiB.
+ * @return Pointer to the newly created fifo, or NULL on failure.
+ */
+spill_fifo* create_spill_fifo(const char* dir, size_t segment_size);
+
+/**
+ * @brief Free the fifo, deleting its segment files and their directory.
+ * @param sf Pointer to the fifo.
+ * @note records still in the fifo are discarded.
+ * @return 0 on success, -1 on failure.
+ */
+int free_spill_fifo(spill_fifo *sf);
+
+/**
+ * @brief Append a copy of a record at the back of the fifo.
+ * @param sf Pointer to the fifo.
+ * @param data Pointer to the record bytes (can be NULL if size is 0).
+ * @param size Size of the record in bytes (at most 4 GiB - 1).
+ * @note the record is buffered and written when the write buffer fills up, or when the reader reaches it.
+ * @return 0 on success, -1 on failure (the fifo is left unchanged).
+ */
+int sfpush(spill_fifo *sf, const void* data, size_t size);
+
+/**
+ * @brief Read the record at the front of the fifo without removing it.
+ * @param sf Pointer to the fifo.
+ * @param data Set to the record bytes, which stay valid until the next call on the fifo.
+ * @return Size of the record in bytes, or -1 if the fifo is empty or can't be read.
+ */
+ssize_t sffront(spill_fifo *sf, const void** data);
+
+/**
+ * @brief Remove the record at the front of the fifo.
+ * @param sf Pointer to the fifo.
+ * @return 0 on success, -1 if the fifo is empty or can't be read.
+ */
+int sfpop(spill_fifo *sf);
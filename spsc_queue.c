@@ -0,0 +1,191 @@
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <sched.h>
+#include <sys/types.h>
+#include "spsc_queue.h"
+
+spsc_queue* create_spsc_queue(ssize_t capacity){
+    size_t size = 1024;
+    // round the capacity up to a power of two so slot lookup is a mask
+    if (capacity > 0){
+        if ((size_t)capacity > SIZE_MAX / 2 / sizeof(void*)) return NULL;
+        size = 1;
+        while (size < (size_t)capacity) size *= 2;
+    }
+
+    // the structure is cache line aligned, which malloc does not guarantee
+    spsc_queue* qu = aligned_alloc(SPSC_CACHE_LINE, sizeof(spsc_queue));
+
+    if (qu == NULL) return NULL;
+
+    qu->slots = malloc(sizeof(void*) * size);
+
+    if (qu->slots == NULL){
+        free(qu);
+        return NULL;
+    }
+
+    atomic_init(&qu->head, 0);
+    atomic_init(&qu->tail, 0);
+    qu->cached_head = 0;
+    qu->cached_tail = 0;
+    qu->mask = size - 1;
+
+    return qu;
+}
+
+// free slots seen by the producer, refreshing its view of head only when the cached one says full
+static size_t producer_room(spsc_queue* qu, size_t tail, size_t wanted){
+    size_t capacity = qu->mask + 1;
+    size_t room = capacity - (tail - qu->cached_head);
+
+    if (room < wanted){
+        qu->cached_head = atomic_load_explicit(&qu->head, memory_order_acquire);
+        room = capacity - (tail - qu->cached_head);
+    }
+
+    return room;
+}
+
+// elements seen by the consumer, refreshing its view of tail only when the cached one says empty
+static size_t consumer_available(spsc_queue* qu, size_t head, size_t wanted){
+    size_t available = qu->cached_tail - head;
+
+    if (available < wanted){
+        qu->cached_tail = atomic_load_explicit(&qu->tail, memory_order_acquire);
+        available = qu->cached_tail - head;
+    }
+
+    return available;
+}
+
+static void backoff(unsigned* spins){
+    if (*spins < 64){
+#if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+#endif
+        (*spins)++;
+        return;
+    }
+    sched_yield();
+}
+
+int spsc_try_enqueue(spsc_queue* qu, void* element){
+    if (qu == NULL || element == NULL) return -1;
+
+    size_t tail = atomic_load_explicit(&qu->tail, memory_order_relaxed);
+
+    if (producer_room(qu, tail, 1) == 0) return -1;
+
+    qu->slots[tail & qu->mask] = element;
+    atomic_store_explicit(&qu->tail, tail + 1, memory_order_release);
+
+    return 0;
+}
+
+int spsc_enqueue(spsc_queue* qu, void* element){
+    if (qu == NULL || element == NULL) return -1;
+
+    unsigned spins = 0;
+
+    while (spsc_try_enqueue(qu, element) == -1)
+        backoff(&spins);
+
+    return 0;
+}
+
+ssize_t spsc_enqueue_batch(spsc_queue* qu, void** elements, ssize_t count){
+    if (qu == NULL || elements == NULL || count < 0) return -1;
+
+    size_t tail = atomic_load_explicit(&qu->tail, memory_order_relaxed);
+    size_t room = producer_room(qu, tail, (size_t)count);
+    size_t n = ((size_t)count < room ? (size_t)count : room);
+
+    for (size_t i = 0; i < n; i++){
+        if (elements[i] == NULL){
+            n = i; // stop before the first NULL, which could not be told apart from an empty slot
+            break;
+        }
+        qu->slots[(tail + i) & qu->mask] = elements[i];
+    }
+
+    atomic_store_explicit(&qu->tail, tail + n, memory_order_release);
+
+    return (ssize_t)n;
+}
+
+void* spsc_try_dequeue(spsc_queue* qu){
+    if (qu == NULL) return NULL;
+
+    size_t head = atomic_load_explicit(&qu->head, memory_order_relaxed);
+
+    if (consumer_available(qu, head, 1) == 0) return NULL;
+
+    void* val = qu->slots[head & qu->mask];
+    atomic_store_explicit(&qu->head, head + 1, memory_order_release);
+
+    return val;
+}
+
+void* spsc_dequeue(spsc_queue* qu){
+    if (qu == NULL) return NULL;
+
+    unsigned spins = 0;
+    void* val;
+
+    while ((val = spsc_try_dequeue(qu)) == NULL)
+        backoff(&spins);
+
+    return val;
+}
+
+ssize_t spsc_dequeue_batch(spsc_queue* qu, void** out, ssize_t max_count){
+    if (qu == NULL || out == NULL || max_count < 0) return -1;
+
+    size_t head = atomic_load_explicit(&qu->head, memory_order_relaxed);
+    size_t available = consumer_available(qu, head, (size_t)max_count);
+    size_t n = ((size_t)max_count < available ? (size_t)max_count : available);
+
+    for (size_t i = 0; i < n; i++)
+        out[i] = qu->slots[(head + i) & qu->mask];
+
+    atomic_store_explicit(&qu->head, head + n, memory_order_release);
+
+    return (ssize_t)n;
+}
+
+void* spsc_queue_front(spsc_queue* qu){
+    if (qu == NULL) return NULL;
+
+    size_t head = atomic_load_explicit(&qu->head, memory_order_relaxed);
+
+    if (consumer_available(qu, head, 1) == 0) return NULL;
+
+    return qu->slots[head & qu->mask];
+}
+
+ssize_t spsc_queue_size(spsc_queue* qu){
+    if (qu == NULL) return -1;
+
+    size_t head = atomic_load_explicit(&qu->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&qu->tail, memory_order_acquire);
+
+    return (ssize_t)(tail - head);
+}
+
+int free_spsc_queue(spsc_queue* qu, void (*free_element) (void*)){
+    if (qu == NULL) return -1;
+
+    size_t head = atomic_load_explicit(&qu->head, memory_order_acquire);
+    size_t tail = atomic_load_explicit(&qu->tail, memory_order_acquire);
+
+    if (free_element != NULL)
+        for (size_t i = head; i != tail; i++)
+            free_element(qu->slots[i & qu->mask]);
+
+    free(qu->slots);
+    free(qu);
+
+    return 0;
+}
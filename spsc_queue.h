@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stdatomic.h>
+#include <stddef.h>
+#include <sys/types.h>
+
+#define SPSC_CACHE_LINE 64
+
+/**
+ * @brief Bounded lock-free queue for exactly one producer thread and one consumer thread.
+ * @note head and tail live on separate cache lines, and each side keeps a cached copy of the other side's index so it only touches the shared line when the cached view says the queue is full (or empty).
+ */
+typedef struct {
+    _Alignas(SPSC_CACHE_LINE) atomic_size_t head; /**< Position of the next element to dequeue, written by the consumer only */
+    size_t cached_tail;                           /**< Consumer's last observed value of tail */
+    _Alignas(SPSC_CACHE_LINE) atomic_size_t tail; /**< Position of the next free slot, written by the producer only */
+    size_t cached_head;                           /**< Producer's last observed value of head */
+    _Alignas(SPSC_CACHE_LINE) void** slots;       /**< Ring of element pointers */
+    size_t mask;                                  /**< capacity - 1, capacity being a power of two */
+} spsc_queue;
+
+/**
+ * @brief Create a new single-producer/single-consumer queue.
+ * @param capacity Maximum number of elements the queue can hold.
+ * @note if the capacity is <=0 it will be defaulted to 1024, otherwise it is rounded up to a power of two. the queue never grows.
+ * @return Pointer to the newly created queue, or NULL on failure.
+ */
+spsc_queue* create_spsc_queue(ssize_t capacity);
+
+/**
+ * @brief Enqueue an element if there is room for it (producer only).
+ * @param qu Pointer to the queue.
+ * @param element Pointer to the element to enqueue (can't be NULL).
+ * @return 0 on success, -1 if the queue is full or on invalid arguments.
+ */
+int spsc_try_enqueue(spsc_queue *qu, void* element);
+
+/**
+ * @brief Enqueue an element, waiting for the consumer to make room if the queue is full (producer only).
+ * @param qu Pointer to the queue.
+ * @param element Pointer to the element to enqueue (can't be NULL).
+ * @return 0 on success, -1 on invalid arguments.
+ */
+int spsc_enqueue(spsc_queue *qu, void* element);
+
+/**
+ * @brief Enqueue as many elements of an array as currently fit (producer only).
+ * @param qu Pointer to the queue.
+ * @param elements Array of element pointers (none of them can be NULL).
+ * @param count Number of elements in the array.
+ * @note the elements are published to the consumer with a single release store.
+ * @return Number of elements enqueued (possibly 0), or -1 on invalid arguments.
+ */
+ssize_t spsc_enqueue_batch(spsc_queue *qu, void** elements, ssize_t count);
+
+/**
+ * @brief Dequeue the front element if there is one (consumer only).
+ * @param qu Pointer to the queue.
+ * @note The memory ownership of the dequeued element is transferred (if it is owned by the queue) to the caller.
+ * @return Pointer to the dequeued element, or NULL if the queue is empty.
+ */
+void* spsc_try_dequeue(spsc_queue *qu);
+
+/**
+ * @brief Dequeue the front element, waiting for the producer if the queue is empty (consumer only).
+ * @param qu Pointer to the queue.
+ * @note The memory ownership of the dequeued element is transferred (if it is owned by the queue) to the caller.
+ * @return Pointer to the dequeued element, or NULL on invalid arguments.
+ */
+void* spsc_dequeue(spsc_queue *qu);
+
+/**
+ * @brief Dequeue up to max_count elements into an array (consumer only).
+ * @param qu Pointer to the queue.
+ * @param out Array receiving the dequeued element pointers in FIFO order.
+ * @param max_count Capacity of the out array.
+ * @note The memory ownership of the dequeued elements is transferred (if it is owned by the queue) to the caller.
+ * @return Number of elements dequeued (possibly 0), or -1 on invalid arguments.
+ */
+ssize_t spsc_dequeue_batch(spsc_queue *qu, void** out, ssize_t max_count);
+
+/**
+ * @brief Peek at the front element of the queue without removing it (consumer only).
+ * @param qu Pointer to the queue.
+ * @note No memory ownership is transferred; the queue still owns the element.
+ * @return Pointer to the front element, or NULL if the queue is empty.
+ */
+void* spsc_queue_front(spsc_queue *qu);
+
+/**
+ * @brief Get the number of elements in the queue.
+ * @param qu Pointer to the queue.
+ * @note while both threads are running the result is only a snapshot.
+ * @return Number of elements, or -1 on invalid arguments.
+ */
+ssize_t spsc_queue_size(spsc_queue *qu);
+
+/**
+ * @brief Free the queue and its elements.
+ * @param qu Pointer to the queue.
+ * @param free_element Function pointer to free the elements (can be NULL).
+ * @note must not run concurrently with the producer or the consumer. memory ownership rules in free_queue apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int free_spsc_queue(spsc_queue *qu, void (*free_element) (void*));
@@ -2,17 +2,24 @@
 #include <string.h>
 #include <sys/types.h>
 #include "array_list.h"
+#include "value_list.h"
 #include "stack.h"
 
 stack* create_stack(ssize_t init_size){
-    stack* stck = malloc(sizeof(stack));
+    return create_stack_with(init_size, NULL);
+}
+
+stack* create_stack_with(ssize_t init_size, const ds_allocator* allocator){
+    if (allocator == NULL) allocator = ds_default_allocator();
+
+    stack* stck = allocator->alloc(allocator->ctx, sizeof(stack));
     
     if (stck == NULL) return NULL;
 
-    stck->arr = create_array_list(init_size);
+    stck->arr = create_array_list_with(init_size, allocator);
 
     if (stck->arr == NULL) {
-        free(stck);
+        allocator->free(allocator->ctx, stck, sizeof(stack));
         return NULL;
     }
     
@@ -32,21 +39,126 @@ void* stack_pop(stack* stck){
  
     void* popped = alget(stck->arr, stck->arr->length - 1);
 
-    stck->arr->length--;
+    // through alpop so an auto shrinking stack gives memory back
+    alpop(stck->arr, NULL);
 
     return popped;
 }
 
+int stack_push_many(stack* stck, void** elements, ssize_t count){
+    if (stck == NULL) return -1;
+
+    return alextend(stck->arr, elements, count);
+}
+
+ssize_t stack_pop_many(stack* stck, void** out, ssize_t max_count){
+    if (stck == NULL || out == NULL || max_count < 0) return -1;
+
+    ssize_t n = (stck->arr->length < max_count ? stck->arr->length : max_count);
+
+    for (ssize_t i = 0; i < n; i++)
+        out[i] = stck->arr->arr[stck->arr->length - 1 - i];
+
+    aldelete_range(stck->arr, stck->arr->length - n, n, NULL);
+
+    return n;
+}
+
 void* stack_peek(stack* stck){
     if (stck == NULL || stck->arr->length <= 0) return NULL;
    
     return alget(stck->arr, stck->arr->length - 1);
 }
 
+int stack_reserve(stack *stck, ssize_t capacity){
+    if (stck == NULL) return -1;
+
+    return alreserve(stck->arr, capacity);
+}
+
+int stack_shrink_to_fit(stack *stck){
+    if (stck == NULL) return -1;
+
+    return alshrink_to_fit(stck->arr);
+}
+
+int stack_set_growth(stack *stck, al_growth_policy policy, ssize_t chunk){
+    if (stck == NULL) return -1;
+
+    return alset_growth(stck->arr, policy, chunk);
+}
+
+int stack_set_auto_shrink(stack *stck, int enabled){
+    if (stck == NULL) return -1;
+
+    return alset_auto_shrink(stck->arr, enabled);
+}
+
+int stack_get_stats(stack *stck, ds_stats* out){
+    if (stck == NULL){
+        if (out != NULL) *out = (ds_stats){0};
+        return -1;
+    }
+
+    return alget_stats(stck->arr, out);
+}
+
+int stack_reset_stats(stack *stck){
+    if (stck == NULL) return -1;
+
+    return alreset_stats(stck->arr);
+}
+
 int free_stack(stack *stck, void (*free_element) (void*)){
     if (stck==NULL) return -1;
 
+    // the stack struct comes from the same allocator as its list
+    const ds_allocator* allocator = stck->arr->allocator;
+
     free_array_list(stck->arr, free_element);
+    allocator->free(allocator->ctx, stck, sizeof(stack));
+
+    return 0;
+}
+
+
+value_stack* create_value_stack(ssize_t element_size, ssize_t init_size){
+    value_stack* stck = malloc(sizeof(value_stack));
+
+    if (stck == NULL) return NULL;
+
+    stck->arr = create_value_list(element_size, init_size);
+
+    if (stck->arr == NULL) {
+        free(stck);
+        return NULL;
+    }
+
+    return stck;
+}
+
+int value_stack_push(value_stack* stck, const void* element){
+    if (stck == NULL) return -1;
+
+    return vlappend(stck->arr, element);
+}
+
+int value_stack_pop(value_stack* stck, void* out){
+    if (stck == NULL) return -1;
+
+    return vlpop(stck->arr, out);
+}
+
+void* value_stack_peek(value_stack* stck){
+    if (stck == NULL || stck->arr->length <= 0) return NULL;
+
+    return vlat(stck->arr, stck->arr->length - 1);
+}
+
+int free_value_stack(value_stack *stck, void (*free_element) (void*)){
+    if (stck==NULL) return -1;
+
+    free_value_list(stck->arr, free_element);
     free(stck);
 
     return 0;
@@ -2,6 +2,7 @@
 
 #include <sys/types.h>
 #include "array_list.h"
+#include "value_list.h"
 
 /**
  * @brief Stack structure built on top of an array list.
@@ -18,6 +19,15 @@ typedef struct{
  */
 stack* create_stack(ssize_t init_size);
 
+/**
+ * @brief Create a new stack whose struct and array come from an allocator.
+ * @param init_size Initial capacity of the stack.
+ * @param allocator Allocator to use (NULL for malloc), it must outlive the stack.
+ * @note see create_stack.
+ * @return Pointer to the newly created stack, or NULL on failure.
+ */
+stack* create_stack_with(ssize_t init_size, const ds_allocator* allocator);
+
 /**
  * @brief Push an element onto the top of the stack.
  * @param stck Pointer to the stack.
@@ -34,6 +44,26 @@ int stack_push(stack *stck, void* element);
  */
 void* stack_pop(stack *stck);
 
+/**
+ * @brief Push several elements onto the stack, in order (the last one ends up on top).
+ * @param stck Pointer to the stack.
+ * @param elements Array of element pointers to push (none of them can be NULL).
+ * @param count Number of elements in the array.
+ * @note the capacity is checked once and the elements are copied with a single memcpy. nothing is pushed on failure.
+ * @return 0 on success, -1 on failure.
+ */
+int stack_push_many(stack *stck, void** elements, ssize_t count);
+
+/**
+ * @brief Pop up to max_count elements from the stack.
+ * @param stck Pointer to the stack.
+ * @param out Array receiving the popped element pointers, the former top first.
+ * @param max_count Capacity of the out array.
+ * @note The memory ownership (if it is owned by the stack) of the popped elements is transfered to the caller.
+ * @return Number of elements popped (0 if the stack is empty), or -1 on failure.
+ */
+ssize_t stack_pop_many(stack *stck, void** out, ssize_t max_count);
+
 /**
  * @brief Peek at the top element of the stack without removing it.
  * @param stck Pointer to the stack.
@@ -42,6 +72,59 @@ void* stack_pop(stack *stck);
  */
 void* stack_peek(stack *stck);
 
+/**
+ * @brief Make sure the stack can hold a number of elements without reallocating.
+ * @param stck Pointer to the stack.
+ * @param capacity Number of elements to make room for.
+ * @note see alreserve.
+ * @return 0 on success, -1 on failure.
+ */
+int stack_reserve(stack *stck, ssize_t capacity);
+
+/**
+ * @brief Release the unused capacity of the stack.
+ * @param stck Pointer to the stack.
+ * @note see alshrink_to_fit.
+ * @return 0 on success, -1 on failure.
+ */
+int stack_shrink_to_fit(stack *stck);
+
+/**
+ * @brief Choose how the stack grows when it is full.
+ * @param stck Pointer to the stack.
+ * @param policy Growth policy.
+ * @param chunk Number of elements added per growth with AL_GROW_CHUNK.
+ * @note see alset_growth.
+ * @return 0 on success, -1 on failure.
+ */
+int stack_set_growth(stack *stck, al_growth_policy policy, ssize_t chunk);
+
+/**
+ * @brief Turn automatic shrinking on or off, so the stack's memory follows its size down after a spike.
+ * @param stck Pointer to the stack.
+ * @param enabled Non-zero to shrink automatically on stack_pop and stack_pop_many.
+ * @note see alset_auto_shrink.
+ * @return 0 on success, -1 on failure.
+ */
+int stack_set_auto_shrink(stack *stck, int enabled);
+
+/**
+ * @brief Copy out the cost counters of the stack.
+ * @param stck Pointer to the stack.
+ * @param out Pointer receiving the counters.
+ * @note see alget_stats, the counters are the ones of the underlying list.
+ * @return 0 on success, -1 on failure or when the counters are compiled out.
+ */
+int stack_get_stats(stack *stck, ds_stats* out);
+
+/**
+ * @brief Reset the cost counters of the stack.
+ * @param stck Pointer to the stack.
+ * @note see alreset_stats.
+ * @return 0 on success, -1 on failure or when the counters are compiled out.
+ */
+int stack_reset_stats(stack *stck);
+
 /**
  * @brief Free the stack and its elements.
  * @param stck Pointer to the stack.
@@ -51,3 +134,52 @@ void* stack_peek(stack *stck);
  */
 int free_stack(stack *stck, void (*free_element) (void*));
 
+
+/**
+ * @brief Stack of fixed-size values built on top of a value list.
+ */
+typedef struct{
+    value_list *arr;    /**< pointer to underlying value list storing stack elements */
+} value_stack;
+
+/**
+ * @brief Create a new value stack.
+ * @param element_size Size in bytes of every element (must be > 0).
+ * @param init_size Initial capacity of the stack.
+ * @note if the init_size <= 0, the stack size would be 10 (the default for the underlying value list).
+ * @return Pointer to the newly created stack, or NULL on failure.
+ */
+value_stack* create_value_stack(ssize_t element_size, ssize_t init_size);
+
+/**
+ * @brief Push a copy of a value onto the top of the stack.
+ * @param stck Pointer to the stack.
+ * @param element Pointer to the value to push (element_size bytes are copied).
+ * @return 0 on success, -1 on failure.
+ */
+int value_stack_push(value_stack *stck, const void* element);
+
+/**
+ * @brief Pop the top value from the stack.
+ * @param stck Pointer to the stack.
+ * @param out Pointer receiving the popped value (can be NULL).
+ * @return 0 on success, -1 if the stack is empty or on failure.
+ */
+int value_stack_pop(value_stack *stck, void* out);
+
+/**
+ * @brief Peek at the top value of the stack without removing it.
+ * @param stck Pointer to the stack.
+ * @note the returned pointer points inside the stack and is invalidated by the next push.
+ * @return Pointer to the top value, or NULL if the stack is empty.
+ */
+void* value_stack_peek(value_stack *stck);
+
+/**
+ * @brief Free the value stack.
+ * @param stck Pointer to the stack.
+ * @param free_element Function pointer called with a pointer to each stored value (can be NULL).
+ * @note memory ownership rules in free_value_list apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int free_value_stack(value_stack *stck, void (*free_element) (void*));
@@ -2,7 +2,10 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <sys/types.h>
+#include <limits.h>
+#include <string.h>
 #include "../array_list.h"
+#include "../thread_pool.h"
 
 // ----------------- Helpers functions -----------------
 
@@ -23,6 +26,23 @@ static int compare_int(void* a, void* b) {
     return (*(int*)a == *(int*)b) ? 0 : -1;
 }
 
+// three-way order for the sorting functions
+static int order_int(void* a, void* b) {
+    int ia = *(int*)a, ib = *(int*)b;
+    return (ia > ib) - (ia < ib);
+}
+
+// elements carrying their original position, ordered by key only
+typedef struct {
+    int key;
+    int position;
+} keyed;
+
+static int order_keyed(void* a, void* b) {
+    int ka = ((keyed*)a)->key, kb = ((keyed*)b)->key;
+    return (ka > kb) - (ka < kb);
+}
+
 static void print_int(void* p) {
     if (p) printf("[%d]", *(int*)p);
 }
@@ -105,6 +125,401 @@ static void test_pop_reverse() {
     free_array_list(list, free_int);
 }
 
+static void test_bulk_operations() {
+    array_list* list = create_array_list(2);
+    void* batch[6];
+    for (int i = 0; i < 6; ++i) batch[i] = make_element_int(i);
+
+    // [0,1,2] with a single capacity check
+    assert(alextend(list, batch, 3) == 0);
+    assert(list->length == 3 && list->max_size == 4);
+
+    // insert [3,4,5] at index 1 → [0,3,4,5,1,2]
+    assert(aladd_range(list, 1, &batch[3], 3) == 0);
+    int expected[] = {0, 3, 4, 5, 1, 2};
+    for (int i = 0; i < 6; ++i) assert(*(int*)alget(list, i) == expected[i]);
+
+    // delete [4,5,1] → [0,3,2]
+    assert(aldelete_range(list, 2, 3, free_int) == 0);
+    assert(list->length == 3);
+    assert(*(int*)alget(list, 1) == 3 && *(int*)alget(list, 2) == 2);
+
+    // empty batches are no-ops
+    assert(alextend(list, batch, 0) == 0);
+    assert(aladd_range(list, 3, batch, 0) == 0);
+    assert(aldelete_range(list, 3, 0, free_int) == 0);
+
+    // invalid batches leave the list untouched
+    void* with_null[2] = {batch[0], NULL};
+    assert(alextend(list, with_null, 2) == -1);
+    assert(aladd_range(list, 0, with_null, 2) == -1);
+    assert(aladd_range(list, 4, batch, 1) == -1);
+    assert(aldelete_range(list, 2, 2, free_int) == -1);
+    assert(aldelete_range(list, -1, 1, free_int) == -1);
+    assert(alextend(NULL, batch, 1) == -1);
+    assert(alextend(list, NULL, 1) == -1);
+    assert(list->length == 3);
+
+    free_array_list(list, free_int);
+}
+
+static void assert_sorted(const array_list* list) {
+    for (ssize_t i = 1; i < list->length; ++i)
+        assert(order_int(list->arr[i - 1], list->arr[i]) <= 0);
+}
+
+static void test_sort_and_binary_search() {
+    // random, ascending, descending, all equal and few distinct values, across the insertion sort threshold
+    ssize_t sizes[] = {0, 1, 2, 15, 16, 17, 100, 1000, 5000};
+    unsigned seed = 12345;
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+        for (int pattern = 0; pattern < 5; ++pattern) {
+            ssize_t n = sizes[s];
+            int* values = malloc(sizeof(int) * (n + 1));
+            array_list* list = create_array_list(n);
+            long sum = 0;
+
+            for (ssize_t i = 0; i < n; ++i) {
+                seed = seed * 1103515245u + 12345u;
+                int v = (pattern == 0 ? (int)(seed >> 8) % 100000 :
+                         pattern == 1 ? (int)i :
+                         pattern == 2 ? (int)(n - i) :
+                         pattern == 3 ? 7 : (int)(seed >> 8) % 4);
+                values[i] = v;
+                sum += v;
+                assert(alappend(list, &values[i]) == 0);
+            }
+
+            array_list* copy = create_array_list(n);
+            assert(alextend(copy, list->arr, list->length) == 0);
+
+            assert(alsort(list, order_int) == 0);
+            assert(alsort_stable(copy, order_int) == 0);
+            assert_sorted(list);
+            assert_sorted(copy);
+
+            // sorting only moves pointers around
+            long sorted_sum = 0;
+            for (ssize_t i = 0; i < n; ++i) sorted_sum += *(int*)list->arr[i];
+            assert(sorted_sum == sum && list->length == n);
+
+            // every element is found at its first occurrence
+            for (ssize_t i = 0; i < n; ++i) {
+                ssize_t found = alsearch_sorted(list, list->arr[i], order_int);
+                assert(found != -1 && found <= i && order_int(list->arr[found], list->arr[i]) == 0);
+                assert(found == 0 || order_int(list->arr[found - 1], list->arr[i]) < 0);
+            }
+            values[n] = -1;
+            assert(alsearch_sorted(list, &values[n], order_int) == -1);
+            assert(allower_bound(list, &values[n], order_int) == 0);
+            assert(alupper_bound(list, &values[n], order_int) == 0);
+
+            free_array_list(copy, NULL);
+            free_array_list(list, NULL);
+            free(values);
+        }
+    }
+}
+
+static void test_bounds_and_sorted_add() {
+    array_list* list = create_array_list(0);
+    int values[] = {10, 20, 20, 20, 30};
+    for (int i = 0; i < 5; ++i) alappend(list, &values[i]);
+
+    int probe = 20;
+    assert(allower_bound(list, &probe, order_int) == 1);
+    assert(alupper_bound(list, &probe, order_int) == 4);
+    assert(alsearch_sorted(list, &probe, order_int) == 1);
+    probe = 25;
+    assert(allower_bound(list, &probe, order_int) == 4);
+    assert(alsearch_sorted(list, &probe, order_int) == -1);
+    probe = 99;
+    assert(allower_bound(list, &probe, order_int) == 5);
+    assert(alsearch_sorted(list, &probe, order_int) == -1);
+
+    // the new 20 goes after the equal ones, 5 to the front, 99 to the back
+    int twenty = 20, five = 5;
+    assert(aladd_sorted(list, &twenty, order_int) == 4);
+    assert(list->arr[4] == &twenty);
+    assert(aladd_sorted(list, &five, order_int) == 0);
+    assert(aladd_sorted(list, &probe, order_int) == 7);
+    assert_sorted(list);
+
+    // invalid inputs
+    assert(alsort(NULL, order_int) == -1);
+    assert(alsort(list, NULL) == -1);
+    assert(alsort_stable(NULL, order_int) == -1);
+    assert(allower_bound(NULL, &probe, order_int) == -1);
+    assert(alupper_bound(list, NULL, order_int) == -1);
+    assert(alsearch_sorted(list, &probe, NULL) == -1);
+    assert(aladd_sorted(list, NULL, order_int) == -1);
+    assert(list->length == 8);
+
+    free_array_list(list, NULL);
+}
+
+static void test_stable_sort_keeps_order() {
+    ssize_t n = 3000;
+    keyed* items = malloc(sizeof(keyed) * n);
+    array_list* list = create_array_list(n);
+
+    for (ssize_t i = 0; i < n; ++i) {
+        items[i].key = (int)((i * 7919) % 13);
+        items[i].position = (int)i;
+        alappend(list, &items[i]);
+    }
+
+    assert(alsort_stable(list, order_keyed) == 0);
+
+    for (ssize_t i = 1; i < n; ++i) {
+        keyed* a = list->arr[i - 1];
+        keyed* b = list->arr[i];
+        assert(a->key < b->key || (a->key == b->key && a->position < b->position));
+    }
+
+    free_array_list(list, NULL);
+    free(items);
+}
+
+static void test_find_ptr() {
+    int values[40];
+
+    for (ssize_t n = 0; n <= 40; ++n) {
+        array_list* list = create_array_list(0);
+        for (ssize_t i = 0; i < n; ++i) alappend(list, &values[i]);
+
+        for (ssize_t i = 0; i < n; ++i) assert(alfind_ptr(list, &values[i]) == i);
+        int other;
+        assert(alfind_ptr(list, &other) == -1);
+
+        free_array_list(list, NULL);
+    }
+
+    // duplicates return the first occurrence
+    array_list* list = create_array_list(0);
+    for (int i = 0; i < 20; ++i) alappend(list, &values[i % 3]);
+    assert(alfind_ptr(list, &values[2]) == 2);
+    assert(alfind_ptr(list, NULL) == -1);
+    assert(alfind_ptr(NULL, &values[0]) == -1);
+    free_array_list(list, NULL);
+}
+
+static void test_capacity_control() {
+    int values[100];
+
+    // 1.5x growth: 10 → 15 → 22
+    array_list* list = create_array_list(10);
+    assert(alset_growth(list, AL_GROW_HALF, 0) == 0);
+    for (int i = 0; i < 16; ++i) alappend(list, &values[i]);
+    assert(list->max_size == 22);
+    free_array_list(list, NULL);
+
+    // fixed chunks: 10 → 17 → 24, and a bulk insert jumps several chunks at once
+    list = create_array_list(10);
+    assert(alset_growth(list, AL_GROW_CHUNK, 7) == 0);
+    for (int i = 0; i < 11; ++i) alappend(list, &values[i]);
+    assert(list->max_size == 17);
+    void* batch[20];
+    for (int i = 0; i < 20; ++i) batch[i] = &values[i];
+    assert(alextend(list, batch, 20) == 0);
+    assert(list->max_size == 31);
+    assert(alset_growth(list, AL_GROW_CHUNK, 0) == -1);
+    assert(alset_growth(NULL, AL_GROW_DOUBLE, 0) == -1);
+    free_array_list(list, NULL);
+
+    // reserve grows to exactly the asked capacity and never shrinks
+    list = create_array_list(4);
+    assert(alreserve(list, 100) == 0 && list->max_size == 100);
+    assert(alreserve(list, 50) == 0 && list->max_size == 100);
+    assert(alreserve(list, -1) == -1);
+    assert(alreserve(list, SSIZE_MAX) == -1);
+    assert(list->max_size == 100);
+
+    // shrink to fit, then growth picks up from the fitted size
+    for (int i = 0; i < 5; ++i) alappend(list, &values[i]);
+    assert(alshrink_to_fit(list) == 0 && list->max_size == 5);
+    assert(*(int**)&list->arr[4] == &values[4]);
+    alappend(list, &values[5]);
+    assert(list->max_size == 10);
+    while (list->length > 0) alpop(list, NULL);
+    assert(alshrink_to_fit(list) == 0 && list->max_size == 1);
+    assert(alshrink_to_fit(NULL) == -1);
+    free_array_list(list, NULL);
+}
+
+static void test_auto_shrink_hysteresis() {
+    int values[1024];
+    array_list* list = create_array_list(8);
+    assert(alset_auto_shrink(list, 1) == 0);
+
+    for (int i = 0; i < 1024; ++i) alappend(list, &values[i]);
+    assert(list->max_size == 1024);
+
+    // nothing happens until the list is down to a quarter of its capacity
+    while (list->length > 257) alpop(list, NULL);
+    assert(list->max_size == 1024);
+    alpop(list, NULL);
+    assert(list->length == 256 && list->max_size == 512);
+
+    // a push right after the shrink has room, no thrashing at the boundary
+    alappend(list, &values[0]);
+    assert(list->max_size == 512);
+    alpop(list, NULL);
+    alpop(list, NULL);
+    assert(list->max_size == 512);
+
+    // a big range delete shrinks by several halvings at once, the contents survive
+    assert(aldelete_range(list, 10, list->length - 20, NULL) == 0);
+    assert(list->length == 20 && list->max_size == 64);
+    assert(list->arr[0] == &values[0] && list->arr[19] == &values[254]);
+
+    // never below the initial capacity
+    while (list->length > 0) aldelete(list, 0, NULL);
+    assert(list->max_size == 8);
+
+    // turning it off keeps the capacity
+    for (int i = 0; i < 100; ++i) alappend(list, &values[i]);
+    assert(alset_auto_shrink(list, 0) == 0);
+    while (list->length > 0) alpop(list, NULL);
+    assert(list->max_size == 128);
+    assert(alset_auto_shrink(NULL, 1) == -1);
+
+    free_array_list(list, NULL);
+}
+
+// callbacks for the parallel functions, ctx is unused unless noted
+static void double_in_place(void* e, ssize_t index, void* ctx) {
+    (void)ctx;
+    assert(*(int*)e == index);
+    *(int*)e *= 2;
+}
+
+static void* map_plus_ctx(void* e, void* ctx) {
+    return make_element_int(*(int*)e + *(int*)ctx);
+}
+
+static void* map_null_on_odd(void* e, void* ctx) {
+    (void)ctx;
+    return (*(int*)e % 2 ? NULL : e);
+}
+
+static int keep_multiple_of_3(void* e, void* ctx) {
+    (void)ctx;
+    return *(int*)e % 3 == 0;
+}
+
+static void sum_long(void* acc, void* e, void* ctx) {
+    (void)ctx;
+    *(long*)acc += *(int*)e;
+}
+
+static void combine_sum(void* acc, const void* partial, void* ctx) {
+    (void)ctx;
+    *(long*)acc += *(const long*)partial;
+}
+
+// string concatenation of digits: associative but not commutative
+static void append_digit(void* acc, void* e, void* ctx) {
+    (void)ctx;
+    char* s = acc;
+    size_t n = strlen(s);
+    s[n] = (char)('0' + *(int*)e % 10);
+    s[n + 1] = '\0';
+}
+
+static void combine_concat(void* acc, const void* partial, void* ctx) {
+    (void)ctx;
+    strcat(acc, partial);
+}
+
+static void test_parallel_map_filter_reduce() {
+    thread_pool* pool = create_thread_pool(4);
+    assert(pool != NULL);
+    thread_pool_set_grain(pool, 100);
+
+    const int N = 100000;
+    array_list* list = create_array_list(N);
+    for (int i = 0; i < N; ++i) alappend(list, make_element_int(i));
+
+    // the same results with and without a pool
+    thread_pool* pools[] = {pool, NULL};
+    for (int p = 0; p < 2; ++p) {
+        int offset = 5;
+        array_list* mapped = almap(list, pools[p], map_plus_ctx, &offset);
+        assert(mapped != NULL && mapped->length == N);
+        for (int i = 0; i < N; ++i) assert(*(int*)alget(mapped, i) == i + 5);
+        free_array_list(mapped, free_int);
+
+        array_list* filtered = alfilter(list, pools[p], keep_multiple_of_3, NULL);
+        assert(filtered != NULL && filtered->length == (N + 2) / 3);
+        for (ssize_t i = 0; i < filtered->length; ++i) assert(*(int*)alget(filtered, i) == i * 3);
+        free_array_list(filtered, NULL);
+
+        long sum = 0;
+        assert(alreduce(list, pools[p], &sum, sizeof(long), sum_long, combine_sum, NULL) == 0);
+        assert(sum == (long)N * (N - 1) / 2);
+    }
+
+    // partial results are combined in order
+    array_list* digits = create_array_list(1000);
+    for (int i = 0; i < 1000; ++i) alappend(digits, &((int*)list->arr[i])[0]);
+    thread_pool_set_grain(pool, 10);
+    char text[1001] = "";
+    assert(alreduce(digits, pool, text, sizeof(text), append_digit, combine_concat, NULL) == 0);
+    for (int i = 0; i < 1000; ++i) assert(text[i] == '0' + i % 10);
+    free_array_list(digits, NULL);
+
+    assert(alparallel_for(list, pool, double_in_place, NULL) == 0);
+    for (int i = 0; i < N; ++i) assert(*(int*)alget(list, i) == 2 * i);
+
+    free_array_list(list, free_int);
+    free_thread_pool(pool);
+}
+
+static void test_parallel_sort() {
+    ssize_t n = 20000;
+    keyed* items = malloc(sizeof(keyed) * n);
+    array_list* list = create_array_list(n);
+
+    // odd and even numbers of runs, merges split in one or many pieces
+    ssize_t threads[] = {1, 2, 3, 4, 7};
+    ssize_t grains[] = {1, 64, 1000};
+    ssize_t lengths[] = {5, 1000, 4097, 20000};
+
+    for (int t = 0; t < 5; ++t) {
+        thread_pool* pool = create_thread_pool(threads[t]);
+        assert(pool != NULL);
+
+        for (int g = 0; g < 3; ++g) {
+            thread_pool_set_grain(pool, grains[g]);
+
+            for (int l = 0; l < 4; ++l) {
+                list->length = 0;
+                for (ssize_t i = 0; i < lengths[l]; ++i) {
+                    items[i].key = (int)((i * 7919 + t) % 97);
+                    items[i].position = (int)i;
+                    alappend(list, &items[i]);
+                }
+
+                assert(alsort_parallel(list, pool, order_keyed) == 0);
+                assert(list->length == lengths[l]);
+
+                for (ssize_t i = 1; i < list->length; ++i) {
+                    keyed* a = list->arr[i - 1];
+                    keyed* b = list->arr[i];
+                    assert(a->key < b->key || (a->key == b->key && a->position < b->position));
+                }
+            }
+        }
+
+        free_thread_pool(pool);
+    }
+
+    free_array_list(list, NULL);
+    free(items);
+}
+
 // ----------------- Edge cases -----------------
 
 static void test_null_and_invalid_inputs() {
@@ -187,6 +602,47 @@ static void test_length_maxsize_invariants() {
 }
 
 // Optional stress test
+static void test_parallel_edge_cases() {
+    thread_pool* pool = create_thread_pool(3);
+    thread_pool_set_grain(pool, 1);
+    array_list* list = create_array_list(0);
+    long sum = 0;
+
+    assert(alparallel_for(NULL, pool, double_in_place, NULL) == -1);
+    assert(alparallel_for(list, pool, NULL, NULL) == -1);
+    assert(almap(list, pool, NULL, NULL) == NULL);
+    assert(alfilter(NULL, pool, keep_multiple_of_3, NULL) == NULL);
+    assert(alreduce(list, pool, NULL, sizeof(long), sum_long, combine_sum, NULL) == -1);
+    assert(alreduce(list, pool, &sum, 0, sum_long, combine_sum, NULL) == -1);
+    assert(alsort_parallel(NULL, pool, order_int) == -1);
+    assert(alsort_parallel(list, pool, NULL) == -1);
+
+    // empty lists
+    assert(alparallel_for(list, pool, double_in_place, NULL) == 0);
+    array_list* out = almap(list, pool, map_null_on_odd, NULL);
+    assert(out != NULL && out->length == 0);
+    free_array_list(out, NULL);
+    out = alfilter(list, pool, keep_multiple_of_3, NULL);
+    assert(out != NULL && out->length == 0);
+    free_array_list(out, NULL);
+    assert(alreduce(list, pool, &sum, sizeof(long), sum_long, combine_sum, NULL) == 0 && sum == 0);
+    assert(alsort_parallel(list, pool, order_int) == 0);
+
+    // more threads than elements, and a map that fails part way
+    int values[2] = {0, 1};
+    alappend(list, &values[0]);
+    alappend(list, &values[1]);
+    assert(almap(list, pool, map_null_on_odd, NULL) == NULL);
+    assert(alreduce(list, pool, &sum, sizeof(long), sum_long, combine_sum, NULL) == 0 && sum == 1);
+    list->arr[0] = &values[1];
+    list->arr[1] = &values[0];
+    assert(alsort_parallel(list, pool, order_int) == 0);
+    assert(list->arr[0] == &values[0] && list->arr[1] == &values[1]);
+
+    free_array_list(list, NULL);
+    free_thread_pool(pool);
+}
+
 static void test_stress_operations() {
     array_list* list = create_array_list(50);
     const int N = 50;
@@ -209,6 +665,15 @@ int main(void) {
     test_add_set_get();
     test_index_delete();
     test_pop_reverse();
+    test_bulk_operations();
+    test_sort_and_binary_search();
+    test_bounds_and_sorted_add();
+    test_stable_sort_keeps_order();
+    test_find_ptr();
+    test_capacity_control();
+    test_auto_shrink_hysteresis();
+    test_parallel_map_filter_reduce();
+    test_parallel_sort();
 
     // Edge
     test_null_and_invalid_inputs();
@@ -216,6 +681,7 @@ int main(void) {
     test_free_element_null();
     test_alget_index_not_found();
     test_length_maxsize_invariants();
+    test_parallel_edge_cases();
 
     // Stress
     test_stress_operations();
@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <sys/types.h>
+#include "../deque.h"
+
+// ----------------- Helpers functions -----------------
+
+static int* make_element_int(int v) {
+    int* p = malloc(sizeof(int));
+    assert(p != NULL);
+    *p = v;
+    return p;
+}
+
+static void free_int(void* p) {
+    free(p);
+}
+
+static int compare_int(void* a, void* b) {
+    if (!a || !b) return -1;
+    return (*(int*)a == *(int*)b) ? 0 : -1;
+}
+
+static void print_int(void* p) {
+    if (p) printf("[%d]", *(int*)p);
+}
+
+// ----------------- Normal usage tests -----------------
+
+static void test_push_pop_both_ends() {
+    deque* dq = create_deque(3);
+    assert(dq != NULL && dq->capacity == 4 && dq->length == 0);
+
+    // [2,1,0,10,11] built from both ends
+    for (int i = 0; i < 3; ++i) assert(dqpush_front(dq, make_element_int(i)) == 0);
+    for (int i = 10; i < 12; ++i) assert(dqpush_back(dq, make_element_int(i)) == 0);
+    assert(dq->length == 5 && dq->capacity == 8);
+
+    assert(*(int*)dqfront(dq) == 2 && *(int*)dqback(dq) == 11);
+    int expected[] = {2, 1, 0, 10, 11};
+    for (int i = 0; i < 5; ++i) assert(*(int*)dqget(dq, i) == expected[i]);
+
+    int* v = dqpop_back(dq);
+    assert(v && *v == 11);
+    free(v);
+    v = dqpop_front(dq);
+    assert(v && *v == 2);
+    free(v);
+    assert(dq->length == 3 && *(int*)dqfront(dq) == 1 && *(int*)dqback(dq) == 10);
+
+    assert(free_deque(dq, free_int) == 0);
+}
+
+static void test_get_set_index() {
+    deque* dq = create_deque(4);
+    for (int i = 0; i < 4; ++i) dqpush_back(dq, make_element_int(i));
+
+    // wrap the ring: the front now sits at the end of the array
+    free(dqpop_front(dq));
+    free(dqpop_front(dq));
+    dqpush_back(dq, make_element_int(4));
+    dqpush_back(dq, make_element_int(5));
+    assert(dq->capacity == 4 && dq->head == 2);
+
+    int target = 4;
+    assert(dqget_index(dq, &target, compare_int) == 2);
+    assert(dqset(dq, 2, make_element_int(40), free_int) == 0);
+    assert(*(int*)dqget(dq, 2) == 40);
+    target = 4;
+    assert(dqget_index(dq, &target, compare_int) == -1);
+
+    dqprint(dq, print_int);
+    assert(free_deque(dq, free_int) == 0);
+}
+
+static void test_batches() {
+    deque* dq = create_deque(4);
+    int values[20];
+    void* batch[20];
+    for (int i = 0; i < 20; ++i) {
+        values[i] = i;
+        batch[i] = &values[i];
+    }
+
+    // wrap first so the batch is split in two runs
+    dqpush_back(dq, batch[0]);
+    dqpush_back(dq, batch[1]);
+    dqpush_back(dq, batch[2]);
+    dqpop_front(dq);
+    dqpop_front(dq);
+    assert(dqpush_back_many(dq, &batch[3], 3) == 0);
+    assert(dq->capacity == 4 && dq->length == 4);
+
+    // a batch bigger than the room left grows the ring once
+    assert(dqpush_back_many(dq, &batch[6], 14) == 0);
+    assert(dq->length == 18 && dq->capacity == 32);
+
+    void* out[20];
+    assert(dqpop_front_many(dq, out, 5) == 5);
+    for (int i = 0; i < 5; ++i) assert(*(int*)out[i] == i + 2);
+    assert(dqpop_front_many(dq, out, 20) == 13);
+    assert(*(int*)out[12] == 19);
+    assert(dqpop_front_many(dq, out, 20) == 0);
+
+    // NULLs in a batch leave the deque untouched
+    void* with_null[2] = {&values[0], NULL};
+    assert(dqpush_back_many(dq, with_null, 2) == -1);
+    assert(dq->length == 0);
+
+    free_deque(dq, NULL);
+}
+
+// ----------------- Edge cases -----------------
+
+static void test_null_and_invalid_inputs() {
+    deque* dq = create_deque(0);
+    assert(dq->capacity == 16);
+    int a = 1;
+
+    assert(dqpush_front(NULL, &a) == -1);
+    assert(dqpush_back(NULL, &a) == -1);
+    assert(dqpush_front(dq, NULL) == -1);
+    assert(dqpush_back(dq, NULL) == -1);
+    assert(dqpop_front(dq) == NULL && dqpop_back(dq) == NULL);
+    assert(dqpop_front(NULL) == NULL && dqpop_back(NULL) == NULL);
+    assert(dqfront(dq) == NULL && dqback(dq) == NULL);
+    assert(dqget(dq, 0) == NULL && dqget(NULL, 0) == NULL);
+    assert(dqset(dq, 0, &a, NULL) == -1);
+    assert(dqpush_back_many(dq, NULL, 1) == -1);
+    assert(dqpop_front_many(dq, NULL, 1) == -1);
+    assert(dqget_index(NULL, &a, compare_int) == -1);
+    dqprint(NULL, print_int);
+
+    dqpush_back(dq, &a);
+    assert(dqget(dq, -1) == NULL && dqget(dq, 1) == NULL);
+    assert(dqset(dq, 1, &a, NULL) == -1);
+    assert(dqset(dq, 0, NULL, NULL) == -1);
+
+    assert(free_deque(NULL, NULL) == -1);
+    assert(free_deque(dq, NULL) == 0);
+}
+
+// ----------------- Stress test -----------------
+
+static void test_sliding_window() {
+    // sliding window maximum: indices kept in a monotonic deque, O(1) work at both ends
+    enum { N = 5000, W = 37 };
+    int* data = malloc(sizeof(int) * N);
+    int* indices = malloc(sizeof(int) * N);
+    unsigned seed = 99;
+    for (int i = 0; i < N; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        data[i] = (int)(seed >> 8) % 1000;
+        indices[i] = i;
+    }
+
+    deque* dq = create_deque(0);
+    for (int i = 0; i < N; ++i) {
+        while (dq->length > 0 && data[*(int*)dqback(dq)] <= data[i]) dqpop_back(dq);
+        assert(dqpush_back(dq, &indices[i]) == 0);
+        if (*(int*)dqfront(dq) <= i - W) dqpop_front(dq);
+
+        if (i >= W - 1) {
+            int expected = data[i];
+            for (int j = i - W + 1; j <= i; ++j) if (data[j] > expected) expected = data[j];
+            assert(data[*(int*)dqfront(dq)] == expected);
+        }
+    }
+    assert(dq->capacity <= 64);
+
+    free_deque(dq, NULL);
+    free(indices);
+    free(data);
+}
+
+int main(void) {
+    // Normal
+    test_push_pop_both_ends();
+    test_get_set_index();
+    test_batches();
+
+    // Edge
+    test_null_and_invalid_inputs();
+
+    // Stress
+    test_sliding_window();
+
+    printf("✅ All deque tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,282 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+#include <sys/types.h>
+#include "../ds_allocator.h"
+#include "../array_list.h"
+#include "../linked_list.h"
+#include "../node_pool.h"
+#include "../deque.h"
+#include "../stack.h"
+#include "../queue.h"
+
+// ----------------- Helpers functions -----------------
+
+// malloc based allocator that checks the sizes it gets back against the ones it handed out
+typedef struct {
+    ssize_t live;
+    ssize_t allocs;
+    size_t live_bytes;
+} tracker;
+
+typedef struct {
+    size_t size;
+    _Alignas(max_align_t) char data[];
+} tracked_block;
+
+static void* tracked_alloc(void* ctx, size_t size) {
+    tracked_block* b = malloc(sizeof(tracked_block) + size);
+    if (b == NULL) return NULL;
+    b->size = size;
+    ((tracker*)ctx)->live++;
+    ((tracker*)ctx)->allocs++;
+    ((tracker*)ctx)->live_bytes += size;
+    return b->data;
+}
+
+static tracked_block* block_of(void* ptr) {
+    return (tracked_block*)((char*)ptr - offsetof(tracked_block, data));
+}
+
+static void* tracked_realloc(void* ctx, void* ptr, size_t old_size, size_t new_size) {
+    if (ptr == NULL) return tracked_alloc(ctx, new_size);
+    assert(block_of(ptr)->size == old_size);
+    tracked_block* b = realloc(block_of(ptr), sizeof(tracked_block) + new_size);
+    if (b == NULL) return NULL;
+    b->size = new_size;
+    ((tracker*)ctx)->live_bytes += new_size - old_size;
+    return b->data;
+}
+
+static void tracked_free(void* ctx, void* ptr, size_t size) {
+    if (ptr == NULL) return;
+    assert(block_of(ptr)->size == size);
+    ((tracker*)ctx)->live--;
+    ((tracker*)ctx)->live_bytes -= size;
+    free(block_of(ptr));
+}
+
+static ds_allocator make_tracked(tracker* t) {
+    memset(t, 0, sizeof(*t));
+    ds_allocator a = { tracked_alloc, tracked_realloc, tracked_free, t };
+    return a;
+}
+
+static int values[1000];
+
+// ----------------- Normal usage tests -----------------
+
+static void test_default_allocator() {
+    const ds_allocator* a = ds_default_allocator();
+    assert(a != NULL && a == ds_default_allocator());
+
+    int* p = a->alloc(a->ctx, sizeof(int) * 4);
+    assert(p != NULL);
+    p[3] = 7;
+    p = a->realloc(a->ctx, p, sizeof(int) * 4, sizeof(int) * 100);
+    assert(p != NULL && p[3] == 7);
+    a->free(a->ctx, p, sizeof(int) * 100);
+
+    // the plain constructors use it
+    array_list* list = create_array_list(4);
+    assert(list->allocator == ds_default_allocator());
+    free_array_list(list, NULL);
+}
+
+static void test_containers_use_the_allocator() {
+    tracker t;
+    ds_allocator a = make_tracked(&t);
+
+    array_list* list = create_array_list_with(2, &a);
+    assert(list != NULL && t.live == 2);
+    for (int i = 0; i < 100; ++i) alappend(list, &values[i]);
+    assert(t.live_bytes == sizeof(array_list) + list->max_size * sizeof(void*));
+    alshrink_to_fit(list);
+    assert(t.live_bytes == sizeof(array_list) + 100 * sizeof(void*));
+    for (int i = 0; i < 40; ++i) alset(list, i, &values[99 - i], NULL);
+    assert(alsort_stable(list, NULL) == -1);
+    free_array_list(list, NULL);
+    assert(t.live == 0 && t.live_bytes == 0);
+
+    // unpooled list: one block per node
+    linked_list* llist = create_linked_list_with(&a);
+    for (int i = 0; i < 10; ++i) llappend(llist, &values[i]);
+    assert(t.live == 11);
+    lldelete(llist, 3, NULL);
+    assert(t.live == 10);
+    free_linked_list(llist, NULL);
+    assert(t.live == 0);
+
+    // pooled list: the private pool takes its slabs from the allocator too
+    llist = create_pooled_linked_list_with(NULL, &a);
+    for (int i = 0; i < 100; ++i) llappend(llist, &values[i]);
+    assert(t.live == 2 + 2);   // list, pool and two slabs of 64 nodes
+    free_linked_list(llist, NULL);
+    assert(t.live == 0);
+
+    node* n = create_node_with(&values[0], &a);
+    assert(n != NULL && n->value == &values[0] && t.live == 1);
+    a.free(a.ctx, n, sizeof(node));
+
+    deque* dq = create_deque_with(2, &a);
+    for (int i = 0; i < 50; ++i) dqpush_back(dq, &values[i]);
+    assert(t.live == 2 && t.live_bytes == sizeof(deque) + dq->capacity * sizeof(void*));
+    free_deque(dq, NULL);
+
+    stack* stck = create_stack_with(0, &a);
+    for (int i = 0; i < 50; ++i) stack_push(stck, &values[i]);
+    assert(t.live == 3);
+    free_stack(stck, NULL);
+
+    queue* qu = create_queue_with(&a);
+    enqueue(qu, &values[1]);
+    assert(t.live == 4);   // queue, list, pool, slab
+    free_queue(qu, NULL);
+
+    qu = create_queue_backend_with(QUEUE_RING_BUFFER, 4, &a);
+    for (int i = 0; i < 10; ++i) enqueue(qu, &values[i]);
+    assert(*(int*)dequeue(qu) == 0);
+    free_queue(qu, NULL);
+
+    assert(t.live == 0 && t.live_bytes == 0);
+    assert(t.allocs > 20);
+}
+
+static void test_arena_basics() {
+    ds_arena* arena = create_arena(1024);
+    const ds_allocator* a = arena_allocator(arena);
+    assert(a != NULL && a->ctx == arena);
+
+    // every block is aligned for any type
+    char* p1 = a->alloc(a->ctx, 3);
+    char* p2 = a->alloc(a->ctx, 5);
+    assert((uintptr_t)p1 % _Alignof(max_align_t) == 0 && (uintptr_t)p2 % _Alignof(max_align_t) == 0);
+    assert(p2 > p1);
+
+    // the latest block grows in place
+    memcpy(p2, "abcd", 5);
+    char* p3 = a->realloc(a->ctx, p2, 5, 200);
+    assert(p3 == p2 && strcmp(p3, "abcd") == 0);
+
+    // an older one is copied
+    char* p4 = a->realloc(a->ctx, p1, 3, 64);
+    assert(p4 != p1);
+
+    // freeing the latest block gives its memory back
+    a->free(a->ctx, p4, 64);
+    assert(a->alloc(a->ctx, 16) == p4);
+    a->free(a->ctx, p1, 3);
+
+    // requests bigger than a block get their own
+    char* big = a->alloc(a->ctx, 10000);
+    assert(big != NULL);
+    memset(big, 1, 10000);
+
+    arena_reset(arena);
+    assert(arena->blocks != NULL);
+    char* again = a->alloc(a->ctx, 8);
+    assert(again == big);
+
+    free_arena(arena);
+}
+
+static void test_request_scoped_arena() {
+    ds_arena* arena = create_arena(0);
+    const ds_allocator* a = arena_allocator(arena);
+
+    for (int request = 0; request < 50; ++request) {
+        array_list* list = create_array_list_with(0, a);
+        linked_list* llist = create_linked_list_with(a);
+        queue* qu = create_queue_with(a);
+        stack* stck = create_stack_with(0, a);
+
+        for (int i = 0; i < 1000; ++i) {
+            assert(alappend(list, &values[i]) == 0);
+            assert(llappend(llist, &values[i]) == 0);
+            assert(enqueue(qu, &values[i]) == 0);
+            assert(stack_push(stck, &values[i]) == 0);
+        }
+        assert(*(int*)alget(list, 999) == 999);
+        assert(*(int*)llget(llist, 500) == 500);
+        assert(*(int*)dequeue(qu) == 0);
+        assert(*(int*)stack_pop(stck) == 999);
+
+        // drop everything of this request at once
+        arena_reset(arena);
+    }
+
+    free_arena(arena);
+}
+
+// ----------------- Edge cases -----------------
+
+static void test_null_and_invalid_inputs() {
+    assert(arena_allocator(NULL) == NULL);
+    arena_reset(NULL);
+    free_arena(NULL);
+
+    ds_arena* arena = create_arena(64);
+    const ds_allocator* a = arena_allocator(arena);
+    arena_reset(arena);   // nothing allocated yet
+    assert(a->alloc(a->ctx, SIZE_MAX) == NULL);
+    assert(a->alloc(a->ctx, 0) != NULL);
+    a->free(a->ctx, NULL, 0);
+    void* p = a->realloc(a->ctx, NULL, 0, 32);
+    assert(p != NULL);
+    free_arena(arena);
+
+    // a failing constructor leaves nothing allocated
+    tracker t;
+    ds_allocator tracked = make_tracked(&t);
+    assert(create_array_list_with(SSIZE_MAX, &tracked) == NULL);
+    assert(create_deque_with(SSIZE_MAX, &tracked) == NULL);
+    assert(create_stack_with(SSIZE_MAX, &tracked) == NULL);
+    assert(create_queue_backend_with(QUEUE_SPILLING, 0, &tracked) == NULL);
+    assert(t.live == 0);
+}
+
+// ----------------- Stress test -----------------
+
+static void test_stress_operations() {
+    tracker t;
+    ds_allocator a = make_tracked(&t);
+
+    array_list* list = create_array_list_with(1, &a);
+    alset_auto_shrink(list, 1);
+    for (int round = 0; round < 20; ++round) {
+        for (int i = 0; i < 1000; ++i) alappend(list, &values[i]);
+        while (list->length > 0) alpop(list, NULL);
+    }
+    assert(t.live == 2 && t.live_bytes == sizeof(array_list) + list->max_size * sizeof(void*));
+    free_array_list(list, NULL);
+
+    linked_list* llist = create_linked_list_with(&a);
+    for (int i = 0; i < 1000; ++i) lladd(llist, i / 2, &values[i]);
+    lldelete_range(llist, 100, 800, NULL);
+    assert(t.live == 1 + 200);
+    free_linked_list(llist, NULL);
+
+    assert(t.live == 0 && t.live_bytes == 0);
+}
+
+int main(void) {
+    for (int i = 0; i < 1000; ++i) values[i] = i;
+
+    // Normal
+    test_default_allocator();
+    test_containers_use_the_allocator();
+    test_arena_basics();
+    test_request_scoped_arena();
+
+    // Edge
+    test_null_and_invalid_inputs();
+
+    // Stress
+    test_stress_operations();
+
+    printf("✅ All ds_allocator tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,177 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <sys/types.h>
+#include "../array_list.h"
+#include "../linked_list.h"
+#include "../deque.h"
+#include "../stack.h"
+#include "../queue.h"
+
+// the counters only exist in DS_STATS builds (cmake -DDS_STATS=ON), otherwise the
+// tests check that the stats calls report them as unavailable
+
+// ----------------- Helpers functions -----------------
+
+static int values[1000];
+
+#ifdef DS_STATS
+
+static int compare_int(void* a, void* b) {
+    if (!a || !b) return -1;
+    return (*(int*)a == *(int*)b) ? 0 : -1;
+}
+
+// ----------------- Normal usage tests -----------------
+
+static void test_array_list_stats() {
+    array_list* list = create_array_list(4);
+    ds_stats st;
+
+    assert(alget_stats(list, &st) == 0);
+    assert(st.operations == 0 && st.peak_capacity == 4 && st.peak_length == 0);
+
+    for (int i = 0; i < 8; ++i) alappend(list, &values[i]);
+    assert(alget_stats(list, &st) == 0);
+    assert(st.operations == 8 && st.reallocations == 1);
+    assert(st.peak_length == 8 && st.peak_capacity == 8);
+    assert(st.bytes_moved == 0);
+
+    // front insert and delete shift every other element
+    aladd(list, 0, &values[8]);
+    aldelete(list, 0, NULL);
+    assert(alget_stats(list, &st) == 0);
+    assert(st.operations == 10 && st.reallocations == 2);
+    assert(st.bytes_moved == 16 * sizeof(void*));
+
+    // a linear search compares up to the match
+    assert(alget_index(list, &values[5], compare_int) == 5);
+    alget_stats(list, &st);
+    assert(st.traversal_steps == 6);
+
+    assert(alreset_stats(list) == 0);
+    alget_stats(list, &st);
+    assert(st.operations == 0 && st.reallocations == 0 && st.bytes_moved == 0 && st.traversal_steps == 0);
+    assert(st.peak_length == 8 && st.peak_capacity == 16);
+
+    // peaks keep the high-water mark after the list shrinks
+    for (int i = 0; i < 6; ++i) alpop(list, NULL);
+    alget_stats(list, &st);
+    assert(st.peak_length == 8 && st.operations == 6);
+
+    free_array_list(list, NULL);
+}
+
+static void test_linked_list_stats() {
+    linked_list* list = create_linked_list();
+    ds_stats st;
+
+    for (int i = 0; i < 100; ++i) llappend(list, &values[i]);
+
+    // index access walks from the closer end
+    assert(llreset_stats(list) == 0);
+    llget(list, 10);
+    llget(list, 89);
+    llget_stats(list, &st);
+    assert(st.operations == 2 && st.traversal_steps == 20);
+    assert(st.peak_length == 100 && st.peak_capacity == 0 && st.reallocations == 0);
+
+    llreset_stats(list);
+    assert(llget_index(list, &values[42], compare_int) == 42);
+    llget_stats(list, &st);
+    assert(st.operations == 1 && st.traversal_steps == 43);
+
+    free_linked_list(list, NULL);
+}
+
+static void test_stack_and_queue_stats() {
+    stack* stck = create_stack(2);
+    ds_stats st;
+
+    for (int i = 0; i < 10; ++i) stack_push(stck, &values[i]);
+    for (int i = 0; i < 10; ++i) stack_pop(stck);
+    assert(stack_get_stats(stck, &st) == 0);
+    // a pop reads the top (alget) then removes it (alpop)
+    assert(st.operations == 30 && st.peak_length == 10 && st.reallocations == 3);
+    assert(stack_reset_stats(stck) == 0);
+    free_stack(stck, NULL);
+
+    queue* qu = create_queue_backend(QUEUE_RING_BUFFER, 4);
+    for (int i = 0; i < 5; ++i) enqueue(qu, &values[i]);
+    assert(queue_get_stats(qu, &st) == 0);
+    assert(st.operations == 5 && st.reallocations == 1 && st.peak_capacity == 8);
+    assert(st.bytes_moved == 4 * sizeof(void*));
+    free_queue(qu, NULL);
+
+    qu = create_queue();
+    for (int i = 0; i < 5; ++i) enqueue(qu, &values[i]);
+    while (dequeue(qu) != NULL) {}
+    assert(queue_get_stats(qu, &st) == 0);
+    assert(st.operations == 10 && st.peak_length == 5);
+    assert(queue_reset_stats(qu) == 0);
+    free_queue(qu, NULL);
+}
+
+#else
+
+static void test_stats_compiled_out() {
+    array_list* list = create_array_list(4);
+    linked_list* llist = create_linked_list();
+    stack* stck = create_stack(4);
+    queue* qu = create_queue();
+    ds_stats st = {1, 1, 1, 1, 1, 1};
+
+    alappend(list, &values[0]);
+    assert(alget_stats(list, &st) == -1 && st.operations == 0 && st.peak_length == 0);
+    assert(alreset_stats(list) == -1);
+    assert(llget_stats(llist, &st) == -1 && llreset_stats(llist) == -1);
+    assert(stack_get_stats(stck, &st) == -1 && stack_reset_stats(stck) == -1);
+    assert(queue_get_stats(qu, &st) == -1 && queue_reset_stats(qu) == -1);
+
+    free_array_list(list, NULL);
+    free_linked_list(llist, NULL);
+    free_stack(stck, NULL);
+    free_queue(qu, NULL);
+}
+
+#endif
+
+// ----------------- Edge cases -----------------
+
+static void test_null_inputs() {
+    ds_stats st;
+    array_list* list = create_array_list(4);
+
+    assert(alget_stats(NULL, &st) == -1);
+    assert(alget_stats(list, NULL) == -1);
+    assert(alreset_stats(NULL) == -1);
+    assert(llget_stats(NULL, &st) == -1);
+    assert(llreset_stats(NULL) == -1);
+    assert(dqget_stats(NULL, &st) == -1);
+    assert(dqreset_stats(NULL) == -1);
+    assert(stack_get_stats(NULL, &st) == -1);
+    assert(stack_reset_stats(NULL) == -1);
+    assert(queue_get_stats(NULL, &st) == -1);
+    assert(queue_reset_stats(NULL) == -1);
+
+    free_array_list(list, NULL);
+}
+
+int main(void) {
+    for (int i = 0; i < 1000; ++i) values[i] = i;
+
+#ifdef DS_STATS
+    // Normal
+    test_array_list_stats();
+    test_linked_list_stats();
+    test_stack_and_queue_stats();
+#else
+    test_stats_compiled_out();
+#endif
+
+    // Edge
+    test_null_inputs();
+
+    printf("✅ All ds_stats tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,249 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <sys/types.h>
+#include "../gap_list.h"
+
+// ----------------- Helpers functions -----------------
+
+static int* make_element_int(int v) {
+    int* p = malloc(sizeof(int));
+    assert(p != NULL);
+    *p = v;
+    return p;
+}
+
+static void free_int(void* p) {
+    free(p);
+}
+
+static int compare_int(void* a, void* b) {
+    if (!a || !b) return -1;
+    return (*(int*)a == *(int*)b) ? 0 : -1;
+}
+
+static void print_int(void* p) {
+    if (p) printf("[%d]", *(int*)p);
+}
+
+// the list holds exactly the values in expected, in order
+static void assert_contents(const gap_list* list, const int* expected, ssize_t n) {
+    assert(list->length == n);
+    assert(list->gap_end - list->gap_start == list->max_size - list->length);
+    for (ssize_t i = 0; i < n; ++i) {
+        int* v = (int*)glget(list, i);
+        assert(v && *v == expected[i]);
+    }
+}
+
+// ----------------- Normal usage tests -----------------
+
+static void test_create_and_append() {
+    gap_list* list = create_gap_list(2);
+    assert(list != NULL);
+    assert(list->length == 0 && list->max_size == 2);
+    assert(list->gap_start == 0 && list->gap_end == 2);
+
+    for (int i = 0; i < 5; ++i) assert(glappend(list, make_element_int(i)) == 0);
+    assert(list->max_size == 8 && list->gap_start == 5);
+
+    int expected[] = {0, 1, 2, 3, 4};
+    assert_contents(list, expected, 5);
+
+    free_gap_list(list, free_int);
+}
+
+static void test_add_set_get() {
+    gap_list* list = create_gap_list(10);
+    glappend(list, make_element_int(1));
+    glappend(list, make_element_int(4));
+
+    // Insert 2 then 3 at the gap → [1,2,3,4], the gap follows the inserts
+    assert(gladd(list, 1, make_element_int(2)) == 0);
+    assert(list->gap_start == 2);
+    assert(gladd(list, 2, make_element_int(3)) == 0);
+    assert(list->gap_start == 3);
+    int expected[] = {1, 2, 3, 4};
+    assert_contents(list, expected, 4);
+
+    // elements after the gap are reached through it
+    assert(glset(list, 3, make_element_int(42), free_int) == 0);
+    assert(*(int*)glget(list, 3) == 42);
+
+    // the contiguous view
+    void** arr = glcompact(list);
+    assert(arr != NULL && list->gap_start == list->length);
+    assert(*(int*)arr[0] == 1 && *(int*)arr[3] == 42);
+
+    free_gap_list(list, free_int);
+}
+
+static void test_index_delete() {
+    gap_list* list = create_gap_list(4);
+    for (int i = 0; i < 6; ++i) glappend(list, make_element_int(i * 5));
+
+    int target = 20;
+    assert(glget_index(list, &target, compare_int) == 4);
+
+    // move the gap to the middle, matches on both sides of it are still found
+    assert(gladd(list, 2, make_element_int(7)) == 0);
+    assert(glget_index(list, &target, compare_int) == 5);
+    target = 5;
+    assert(glget_index(list, &target, compare_int) == 1);
+
+    // backspace right before the gap, then delete forward at it → [0,5,15,20,25]
+    assert(gldelete(list, 2, free_int) == 0);
+    assert(list->gap_start == 2);
+    assert(gldelete(list, 2, free_int) == 0);
+    int expected[] = {0, 5, 15, 20, 25};
+    assert_contents(list, expected, 5);
+
+    free_gap_list(list, free_int);
+}
+
+static void test_pop_reverse() {
+    gap_list* list = create_gap_list(10);
+    for (int i = 1; i <= 5; ++i) glappend(list, make_element_int(i));
+    gladd(list, 2, make_element_int(9));   // [1,2,9,3,4,5], gap after 9
+
+    glreverse(list);
+    int reversed[] = {5, 4, 3, 9, 2, 1};
+    assert_contents(list, reversed, 6);
+
+    assert(glpop(list, free_int) == 0);
+    assert(glpop(list, free_int) == 0);
+    int popped[] = {5, 4, 3, 9};
+    assert_contents(list, popped, 4);
+
+    free_gap_list(list, free_int);
+}
+
+static void test_clustered_edits() {
+    // an editing session: type a burst in the middle, backspace a few, type again
+    gap_list* list = create_gap_list(0);
+    int model[400];
+    ssize_t n = 0;
+
+    for (int i = 0; i < 100; ++i) {
+        glappend(list, make_element_int(i));
+        model[n++] = i;
+    }
+
+    ssize_t cursor = 50;
+    for (int round = 0; round < 5; ++round) {
+        for (int k = 0; k < 40; ++k) {
+            int v = 1000 + round * 100 + k;
+            assert(gladd(list, cursor, make_element_int(v)) == 0);
+            for (ssize_t j = n; j > cursor; --j) model[j] = model[j - 1];
+            model[cursor++] = v;
+            n++;
+        }
+        for (int k = 0; k < 15; ++k) {
+            assert(gldelete(list, --cursor, free_int) == 0);
+            for (ssize_t j = cursor; j < n - 1; ++j) model[j] = model[j + 1];
+            n--;
+        }
+        // jump somewhere else before the next burst
+        cursor = (cursor * 7) % n;
+    }
+
+    assert_contents(list, model, n);
+    free_gap_list(list, free_int);
+}
+
+// ----------------- Edge cases -----------------
+
+static void test_null_and_invalid_inputs() {
+    gap_list* list = create_gap_list(5);
+    int* p = make_element_int(2);
+    int* q = make_element_int(5);
+
+    assert(glappend(NULL, p) == -1);
+    assert(gladd(NULL, 0, p) == -1);
+    assert(glset(NULL, 0, q, free_int) == -1);
+    assert(glget(NULL, 0) == NULL);
+    assert(gldelete(NULL, 0, free_int) == -1);
+    assert(glpop(NULL, free_int) == -1);
+    assert(glcompact(NULL) == NULL);
+    assert(glget_index(NULL, p, compare_int) == -1);
+    glreverse(NULL);
+    glprint(NULL, print_int);
+
+    // Invalid indices and elements
+    glappend(list, q);
+    assert(glappend(list, NULL) == -1);
+    assert(glget(list, -1) == NULL);
+    assert(glget(list, list->length) == NULL);
+    assert(gladd(list, list->length + 1, q) == -1);
+    assert(gldelete(list, list->length, free_int) == -1);
+    assert(glset(list, list->length, p, free_int) == -1);
+    assert(list->length == 1);
+
+    free(p);
+    free_gap_list(list, free_int);
+}
+
+static void test_empty_list_operations() {
+    gap_list* list = create_gap_list(0);
+    assert(list->max_size == 10);
+    assert(glpop(list, free_int) == -1);
+    assert(gldelete(list, 0, free_int) == -1);
+    assert(glget(list, 0) == NULL);
+    assert(glcompact(list) == list->arr);
+    glreverse(list);
+    glprint(list, print_int);
+    free_gap_list(list, free_int);
+}
+
+// ----------------- Stress test -----------------
+
+static void test_stress_operations() {
+    gap_list* list = create_gap_list(1);
+    const int N = 2000;
+    int* model = malloc(sizeof(int) * N);
+    ssize_t n = 0;
+    unsigned seed = 7;
+
+    for (int i = 0; i < N; ++i) {
+        seed = seed * 1103515245u + 12345u;
+        ssize_t index = (ssize_t)((seed >> 8) % (unsigned)(n + 1));
+        // mostly inserts, with deletes at random places mixed in
+        if (n > 0 && (seed >> 4) % 4 == 0) {
+            index = index % n;
+            assert(gldelete(list, index, free_int) == 0);
+            for (ssize_t j = index; j < n - 1; ++j) model[j] = model[j + 1];
+            n--;
+        } else {
+            assert(gladd(list, index, make_element_int(i)) == 0);
+            for (ssize_t j = n; j > index; --j) model[j] = model[j - 1];
+            model[index] = i;
+            n++;
+        }
+    }
+
+    assert_contents(list, model, n);
+    void** arr = glcompact(list);
+    for (ssize_t i = 0; i < n; ++i) assert(*(int*)arr[i] == model[i]);
+
+    free(model);
+    free_gap_list(list, free_int);
+}
+
+int main(void) {
+    // Normal
+    test_create_and_append();
+    test_add_set_get();
+    test_index_delete();
+    test_pop_reverse();
+    test_clustered_edits();
+
+    // Edge
+    test_null_and_invalid_inputs();
+    test_empty_list_operations();
+
+    // Stress
+    test_stress_operations();
+
+    printf("✅ All gap_list tests passed!\n");
+    return 0;
+}
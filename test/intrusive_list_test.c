@@ -0,0 +1,212 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <sys/types.h>
+#include "../intrusive_list.h"
+
+// ----------------- Helper functions -----------------
+
+// a caller-owned struct carrying its own link
+typedef struct {
+    int value;
+    ilist_link link;
+} item;
+
+static item *make_item(int v) {
+    item *p = malloc(sizeof(item));
+    assert(p != NULL);
+    p->value = v;
+    p->link.next = NULL;
+    p->link.prev = NULL;
+    return p;
+}
+
+static int value_of(ilist_link *link) {
+    return ilist_entry(link, item, link)->value;
+}
+
+static void free_item(ilist_link *link) {
+    free(ilist_entry(link, item, link));
+}
+
+static int compare_item(ilist_link *a, ilist_link *b) {
+    if (a == NULL || b == NULL) return -1;
+    return (value_of(a) == value_of(b)) ? 0 : -1;
+}
+
+static void print_item(ilist_link *link) {
+    printf("[%d]", value_of(link));
+}
+
+// ----------------- Tests -----------------
+
+static void test_append_and_get() {
+    intrusive_list list;
+    init_intrusive_list(&list);
+    assert(list.head == NULL && list.tail == NULL && list.length == 0);
+
+    item *a = make_item(10);
+    item *b = make_item(20);
+    assert(ilappend(&list, &a->link) == 0);
+    assert(ilappend(&list, &b->link) == 0);
+    assert(list.length == 2);
+
+    // the list hands back the caller's own structs
+    assert(ilist_entry(ilget(&list, 0), item, link) == a);
+    assert(ilist_entry(ilget(&list, 1), item, link) == b);
+
+    clear_intrusive_list(&list, free_item);
+    assert(list.length == 0 && list.head == NULL);
+}
+
+static void test_add_set_get() {
+    intrusive_list list;
+    init_intrusive_list(&list);
+
+    ilappend(&list, &make_item(1)->link);
+    ilappend(&list, &make_item(3)->link);
+
+    // Insert 2 at index 1 → [1,2,3]
+    assert(iladd(&list, 1, &make_item(2)->link) == 0);
+    assert(list.length == 3);
+    assert(value_of(ilget(&list, 1)) == 2);
+
+    assert(ilset(&list, 1, &make_item(42)->link, free_item) == 0);
+    assert(value_of(ilget(&list, 1)) == 42);
+    assert(value_of(list.head) == 1 && value_of(list.tail) == 3);
+
+    clear_intrusive_list(&list, free_item);
+}
+
+static void test_index_delete_remove() {
+    intrusive_list list;
+    init_intrusive_list(&list);
+
+    item *items[5];
+    for (int i = 0; i < 5; ++i) {
+        items[i] = make_item(i * 5);
+        ilappend(&list, &items[i]->link);
+    }
+
+    item target = { .value = 10 };
+    assert(ilget_index(&list, &target.link, compare_item) == 2);
+
+    // Delete index 2 → [0,5,15,20]
+    assert(ildelete(&list, 2, free_item) == 0);
+    assert(list.length == 4);
+    assert(value_of(ilget(&list, 2)) == 15);
+
+    // O(1) removal of a known entry, ownership stays with the caller
+    assert(ilremove(&list, &items[1]->link, NULL) == 0);
+    assert(items[1]->link.next == NULL && items[1]->link.prev == NULL);
+    free(items[1]);
+    assert(list.length == 3);
+    assert(value_of(ilget(&list, 1)) == 15);
+
+    assert(ilinsert_after(&list, &items[0]->link, &make_item(7)->link) == 0);
+    assert(value_of(ilget(&list, 1)) == 7);
+
+    clear_intrusive_list(&list, free_item);
+}
+
+static void test_pop_reverse_iterate() {
+    intrusive_list list;
+    init_intrusive_list(&list);
+
+    for (int i = 1; i <= 3; ++i) ilappend(&list, &make_item(i)->link);
+
+    // Reverse → [3,2,1]
+    ilreverse(&list);
+    int expected = 3;
+    ilforeach(&list, it) assert(value_of(it) == expected--);
+    assert(list.head->prev == NULL && list.tail->next == NULL);
+
+    // Pop last → removes 1
+    assert(ilpop(&list, free_item) == 0);
+    assert(list.length == 2);
+    assert(value_of(list.tail) == 2);
+
+    // removing while iterating
+    ilforeach_safe(&list, it, tmp) ilremove(&list, it, free_item);
+    assert(list.length == 0 && list.head == NULL && list.tail == NULL);
+}
+
+// ----------------- Edge Case Tests -----------------
+
+static void test_null_and_invalid_inputs() {
+    intrusive_list list;
+    init_intrusive_list(&list);
+    item *p = make_item(2);
+
+    init_intrusive_list(NULL);
+    assert(ilappend(NULL, &p->link) == -1);
+    assert(iladd(NULL, 0, &p->link) == -1);
+    assert(ilset(NULL, 0, &p->link, NULL) == -1);
+    assert(ilget_index(NULL, &p->link, compare_item) == -1);
+    assert(ilget_index(&list, &p->link, NULL) == -1);
+    assert(ilget(NULL, 0) == NULL);
+    assert(ildelete(NULL, 0, NULL) == -1);
+    assert(ilpop(NULL, NULL) == -1);
+    assert(ilremove(NULL, &p->link, NULL) == -1);
+    assert(clear_intrusive_list(NULL, NULL) == -1);
+    ilreverse(NULL);
+    ilprint(NULL, print_item);
+
+    // Empty list
+    assert(ilpop(&list, NULL) == -1);
+    assert(ildelete(&list, 0, NULL) == -1);
+    assert(ilremove(&list, &p->link, NULL) == -1);
+    ilreverse(&list);
+    ilprint(&list, print_item);
+
+    // Invalid indices
+    assert(ilappend(&list, NULL) == -1);
+    assert(ilappend(&list, &p->link) == 0);
+    assert(ilget(&list, -1) == NULL);
+    assert(ilget(&list, 1) == NULL);
+    assert(iladd(&list, 2, &p->link) == -1);
+    assert(ildelete(&list, 1, NULL) == -1);
+
+    clear_intrusive_list(&list, free_item);
+}
+
+// ----------------- Stress test -----------------
+
+static void test_stress_operations() {
+    intrusive_list list;
+    init_intrusive_list(&list);
+    const int N = 100;
+
+    for (int i = 0; i < N; ++i) assert(ilappend(&list, &make_item(i)->link) == 0);
+
+    ilreverse(&list);
+    assert(value_of(ilget(&list, 0)) == N - 1);
+    assert(value_of(ilget(&list, N - 1)) == 0);
+
+    for (int i = 0; i < 10; ++i) assert(ildelete(&list, 10, free_item) == 0);
+    for (int i = 0; i < 5; ++i) assert(ilset(&list, i, &make_item(i * 1000)->link, free_item) == 0);
+    assert(list.length == N - 10);
+
+    ssize_t count = 0;
+    ilforeach(&list, it) count++;
+    assert(count == list.length);
+
+    clear_intrusive_list(&list, free_item);
+}
+
+int main(void) {
+    // Normal operations
+    test_append_and_get();
+    test_add_set_get();
+    test_index_delete_remove();
+    test_pop_reverse_iterate();
+
+    // Edge cases
+    test_null_and_invalid_inputs();
+
+    // Stress
+    test_stress_operations();
+
+    printf("✅ All intrusive_list tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,160 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <assert.h>
+#include <pthread.h>
+#include "../lf_stack.h"
+
+// ----------------- Helpers -----------------
+
+static int* make_element_int(int v) {
+    int* p = malloc(sizeof(int));
+    assert(p != NULL);
+    *p = v;
+    return p;
+}
+
+static void free_int(void* p) {
+    free(p);
+}
+
+// elements are encoded as non-NULL integers so the threaded test allocates nothing
+#define TO_ELEMENT(i) ((void*)(uintptr_t)((i) + 1))
+#define FROM_ELEMENT(p) ((long)(uintptr_t)(p) - 1)
+
+// ----------------- Normal usage tests -----------------
+
+static void test_push_pop_peek() {
+    lf_stack* st = create_lf_stack(5);
+    assert(st != NULL);
+
+    assert(lf_stack_push(st, make_element_int(10)) == 0);
+    assert(lf_stack_push(st, make_element_int(20)) == 0);
+    assert(lf_stack_push(st, make_element_int(30)) == 0);
+
+    int* top = (int*)lf_stack_peek(st);
+    assert(top && *top == 30);
+
+    int* popped = (int*)lf_stack_pop(st);
+    assert(popped && *popped == 30);
+    free(popped);
+
+    top = (int*)lf_stack_peek(st);
+    assert(top && *top == 20);
+
+    popped = (int*)lf_stack_pop(st);
+    assert(popped && *popped == 20);
+    free(popped);
+
+    popped = (int*)lf_stack_pop(st);
+    assert(popped && *popped == 10);
+    free(popped);
+
+    assert(lf_stack_pop(st) == NULL);
+    assert(lf_stack_peek(st) == NULL);
+
+    free_lf_stack(st, free_int);
+}
+
+static void test_node_reuse_and_growth() {
+    lf_stack* st = create_lf_stack(0);
+    assert(st != NULL);
+
+    // popped nodes are recycled, so churning never allocates past the high water mark
+    for (int round = 0; round < 10; ++round) {
+        for (long i = 0; i < 10; ++i) assert(lf_stack_push(st, TO_ELEMENT(i)) == 0);
+        for (long i = 9; i >= 0; --i) assert(FROM_ELEMENT(lf_stack_pop(st)) == i);
+    }
+    assert(atomic_load(&st->allocated) == 10);
+
+    // growing past the first segment adds more segments
+    for (long i = 0; i < 1000; ++i) assert(lf_stack_push(st, TO_ELEMENT(i)) == 0);
+    assert(atomic_load(&st->segments[1]) != NULL);
+    assert(atomic_load(&st->segments[3]) != NULL);
+    for (long i = 999; i >= 0; --i) assert(FROM_ELEMENT(lf_stack_pop(st)) == i);
+
+    free_lf_stack(st, NULL);
+}
+
+// ----------------- Edge cases -----------------
+
+static void test_null_and_empty_stack() {
+    int* num = make_element_int(1);
+    assert(lf_stack_push(NULL, num) == -1);
+    assert(lf_stack_pop(NULL) == NULL);
+    assert(lf_stack_peek(NULL) == NULL);
+    assert(free_lf_stack(NULL, free_int) == -1);
+
+    lf_stack* st = create_lf_stack(5);
+    assert(st != NULL);
+    assert(lf_stack_push(st, NULL) == -1);
+    assert(lf_stack_pop(st) == NULL);
+
+    // elements left on the stack are freed with it
+    assert(lf_stack_push(st, num) == 0);
+    assert(free_lf_stack(st, free_int) == 0);
+}
+
+// ----------------- Multi-threaded test -----------------
+
+#define THREADS 8
+#define PER_THREAD 50000L
+
+typedef struct {
+    lf_stack* st;
+    long id;
+    long sum;
+} worker_arg;
+
+// every thread pushes its own values and pops whatever is on top, like workers sharing a free list
+static void* worker(void* p) {
+    worker_arg* arg = p;
+    for (long i = 0; i < PER_THREAD; ++i) {
+        assert(lf_stack_push(arg->st, TO_ELEMENT(arg->id * PER_THREAD + i)) == 0);
+        if (i % 2 == 1) {
+            void* a = lf_stack_pop(arg->st);
+            void* b = lf_stack_pop(arg->st);
+            // this thread pushed two more than it popped so far, so the stack can't be empty
+            assert(a != NULL && b != NULL);
+            arg->sum += FROM_ELEMENT(a) + FROM_ELEMENT(b);
+        }
+    }
+    return NULL;
+}
+
+static void test_concurrent_push_pop() {
+    lf_stack* st = create_lf_stack(0);
+    pthread_t threads[THREADS];
+    worker_arg args[THREADS];
+
+    for (long i = 0; i < THREADS; ++i) {
+        args[i].st = st;
+        args[i].id = i;
+        args[i].sum = 0;
+        assert(pthread_create(&threads[i], NULL, worker, &args[i]) == 0);
+    }
+    for (int i = 0; i < THREADS; ++i) pthread_join(threads[i], NULL);
+
+    // each value was popped exactly once
+    long total = THREADS * PER_THREAD, sum = 0;
+    for (int i = 0; i < THREADS; ++i) sum += args[i].sum;
+    assert(sum == total * (total - 1) / 2);
+    assert(lf_stack_pop(st) == NULL);
+
+    free_lf_stack(st, NULL);
+}
+
+int main(void) {
+    // Normal
+    test_push_pop_peek();
+    test_node_reuse_and_growth();
+
+    // Edge
+    test_null_and_empty_stack();
+
+    // Threads
+    test_concurrent_push_pop();
+
+    printf("✅ All lf_stack tests passed!\n");
+    return 0;
+}
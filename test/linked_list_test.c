@@ -116,6 +116,44 @@ static void test_pop_reverse() {
     free_linked_list(list, free_int);
 }
 
+static void test_bulk_operations() {
+    linked_list *list = create_linked_list();
+    void *batch[6];
+    for (int i = 0; i < 6; ++i) batch[i] = make_element_int(i);
+
+    // [0,1,2] into an empty list, then [3,4,5] at index 1 → [0,3,4,5,1,2]
+    assert(lladd_range(list, 0, batch, 3) == 0);
+    assert(lladd_range(list, 1, &batch[3], 3) == 0);
+    assert(list->length == 6);
+    int expected[] = {0, 3, 4, 5, 1, 2};
+    for (int i = 0; i < 6; ++i) assert(*(int *)llget(list, i) == expected[i]);
+    assert(*(int *)list->tail->value == 2 && list->tail->next == NULL);
+
+    // delete [4,5,1] → [0,3,2], then the head range → [2]
+    assert(lldelete_range(list, 2, 3, free_int) == 0);
+    assert(list->length == 3);
+    assert(*(int *)llget(list, 2) == 2 && list->tail->prev == llget_node(list, 1));
+    assert(lldelete_range(list, 0, 2, free_int) == 0);
+    assert(list->length == 1 && list->head == list->tail && list->head->prev == NULL);
+
+    // invalid batches leave the list untouched
+    int *extra = make_element_int(9);
+    void *with_null[2] = {extra, NULL};
+    assert(lladd_range(list, 0, with_null, 2) == -1);
+    assert(lladd_range(list, 2, with_null, 1) == -1);
+    assert(lldelete_range(list, 0, 2, free_int) == -1);
+    assert(lladd_range(NULL, 0, with_null, 1) == -1);
+    assert(lldelete_range(NULL, 0, 1, free_int) == -1);
+    assert(list->length == 1);
+
+    // deleting the whole list through a range empties it
+    assert(lladd_range(list, 1, with_null, 1) == 0);
+    assert(lldelete_range(list, 0, 2, free_int) == 0);
+    assert(list->head == NULL && list->tail == NULL && list->length == 0);
+
+    free_linked_list(list, free_int);
+}
+
 // ----------------- Edge Case Tests -----------------
 
 static void test_null_and_invalid_inputs() {
@@ -224,6 +262,134 @@ static void test_head_tail_length_invariants() {
     free_linked_list(list, free_int);
 }
 
+// prev links must mirror next links in both directions
+static void check_links(const linked_list *list) {
+    ssize_t count = 0;
+    node *prev = NULL;
+    for (node *n = list->head; n != NULL; n = n->next) {
+        assert(n->prev == prev);
+        prev = n;
+        count++;
+    }
+    assert(list->tail == prev);
+    assert(count == list->length);
+}
+
+static void test_prev_links_and_back_half_access() {
+    linked_list *list = create_linked_list();
+    assert(list != NULL);
+
+    for (int i = 0; i < 10; ++i) assert(llappend(list, make_element_int(i)) == 0);
+    assert(lladd(list, 0, make_element_int(-1)) == 0);
+    assert(lladd(list, 8, make_element_int(100)) == 0);
+    check_links(list);
+
+    // indices in the back half are reached from the tail
+    int *v = (int *)llget(list, 8);
+    assert(v != NULL && *v == 100);
+    assert(llget_node(list, list->length - 1) == list->tail);
+
+    assert(lldelete(list, 8, free_int) == 0);
+    assert(lldelete(list, 0, free_int) == 0);
+    assert(llpop(list, free_int) == 0);
+    check_links(list);
+
+    llreverse(list);
+    check_links(list);
+    v = (int *)llget(list, 0);
+    assert(v != NULL && *v == 8);
+
+    // draining from the tail walks nothing
+    while (list->length > 0) {
+        node *pretail = list->tail->prev;
+        assert(llpop(list, free_int) == 0);
+        assert(list->tail == pretail);
+    }
+    assert(list->head == NULL);
+
+    free_linked_list(list, free_int);
+}
+
+static void test_cursor_scan_and_edits() {
+    linked_list *list = create_linked_list();
+
+    // filling an empty list through a cursor past the end
+    ll_cursor cur = llcursor_begin(list);
+    assert(!llcursor_valid(&cur) && cur.index == 0);
+    for (int i = 0; i < 6; ++i) assert(llcursor_insert_before(list, &cur, make_element_int(i)) == 0);
+    assert(list->length == 6 && cur.index == 6);
+    check_links(list);
+
+    // one forward pass: drop odd values, double the even ones and insert a marker after 2 → [0,4,-1,8]
+    cur = llcursor_begin(list);
+    while (llcursor_valid(&cur)) {
+        int v = *(int *)llcursor_get(&cur);
+        assert(llget(list, cur.index) == llcursor_get(&cur));
+        if (v % 2 != 0) {
+            assert(llcursor_delete(list, &cur, free_int) == 0);
+            continue;
+        }
+        assert(llcursor_set(&cur, make_element_int(v * 2), free_int) == 0);
+        if (v == 2) {
+            assert(llcursor_insert_after(list, &cur, make_element_int(-1)) == 0);
+            llcursor_next(&cur);
+        }
+        llcursor_next(&cur);
+    }
+    assert(cur.index == list->length);
+    int expected[] = {0, 4, -1, 8};
+    assert(list->length == 4);
+    for (int i = 0; i < 4; ++i) assert(*(int *)llget(list, i) == expected[i]);
+    check_links(list);
+
+    // backwards walk, deleting the tail keeps the tail pointer right
+    cur = llcursor_last(list);
+    assert(cur.index == 3 && *(int *)llcursor_get(&cur) == 8);
+    assert(llcursor_delete(list, &cur, free_int) == 0);
+    assert(!llcursor_valid(&cur) && list->length == 3);
+    check_links(list);
+    cur = llcursor_last(list);
+    assert(llcursor_prev(&cur) == 0 && cur.index == 1 && *(int *)llcursor_get(&cur) == 4);
+    assert(llcursor_prev(&cur) == 0 && llcursor_prev(&cur) == -1 && cur.index == -1);
+    assert(llcursor_next(&cur) == -1); // stays off the list
+
+    // cursor from an index, inserting before the head
+    cur = llcursor_at(list, 0);
+    assert(llcursor_insert_before(list, &cur, make_element_int(7)) == 0);
+    assert(cur.index == 1 && *(int *)list->head->value == 7);
+    check_links(list);
+
+    // llget_index runs on cursors
+    int key = -1;
+    assert(llget_index(list, &key, compare_int) == 3);
+
+    // invalid uses
+    cur = llcursor_at(list, 10);
+    assert(!llcursor_valid(&cur) && cur.index == list->length);
+    assert(llcursor_get(&cur) == NULL);
+    assert(llcursor_insert_after(list, &cur, &key) == -1);
+    assert(llcursor_delete(list, &cur, NULL) == -1);
+    assert(llcursor_set(&cur, &key, NULL) == -1);
+    cur = llcursor_at(list, -3);
+    assert(cur.index == -1 && llcursor_insert_before(list, &cur, &key) == -1);
+    cur = llcursor_begin(list);
+    assert(llcursor_set(&cur, NULL, NULL) == -1);
+    assert(llcursor_insert_after(NULL, &cur, &key) == -1);
+    assert(llcursor_valid(NULL) == 0 && llcursor_next(NULL) == -1);
+    cur = llcursor_begin(NULL);
+    assert(!llcursor_valid(&cur));
+
+    // freeing goes through the cursor walk too
+    free_linked_list(list, free_int);
+
+    linked_list *pooled = create_pooled_linked_list(NULL);
+    cur = llcursor_begin(pooled);
+    for (int i = 0; i < 100; ++i) assert(llcursor_insert_before(pooled, &cur, make_element_int(i)) == 0);
+    for (cur = llcursor_begin(pooled); llcursor_valid(&cur);) assert(llcursor_delete(pooled, &cur, free_int) == 0);
+    assert(pooled->length == 0 && pooled->head == NULL && pooled->tail == NULL);
+    free_linked_list(pooled, free_int);
+}
+
 // Optional: a stress test to exercise many operations (keeps runtime small)
 static void test_stress_operations() {
     linked_list *list = create_linked_list();
@@ -261,6 +427,7 @@ int main(void) {
     test_add_set_get();
     test_index_delete();
     test_pop_reverse();
+    test_bulk_operations();
 
     // Edge cases
     test_null_and_invalid_inputs();
@@ -268,6 +435,8 @@ int main(void) {
     test_free_element_null();
     test_llget_index_not_found();
     test_head_tail_length_invariants();
+    test_prev_links_and_back_half_access();
+    test_cursor_scan_and_edits();
 
     // Stress
     test_stress_operations();
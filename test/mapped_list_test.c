@@ -0,0 +1,279 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include "../mapped_list.h"
+
+// ----------------- Helpers functions -----------------
+
+typedef struct {
+    int id;
+    double weight;
+} record;
+
+static int compare_record_id(void* a, void* b) {
+    if (!a || !b) return -1;
+    return (((record*)a)->id == ((record*)b)->id) ? 0 : -1;
+}
+
+static void print_int(void* p) {
+    if (p) printf("[%d]", *(int*)p);
+}
+
+// fresh path in /tmp, the file itself is removed so open_mapped_list creates it
+static void temp_path(char* path, size_t size) {
+    snprintf(path, size, "/tmp/mapped_list_testXXXXXX");
+    int fd = mkstemp(path);
+    assert(fd != -1);
+    close(fd);
+    unlink(path);
+}
+
+// ----------------- Normal usage tests -----------------
+
+static void test_open_and_append() {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    mapped_list* list = open_mapped_list(path, sizeof(int), 10);
+    assert(list != NULL);
+    assert(list->length == 0 && list->max_size == 10 && list->element_size == sizeof(int));
+
+    int a = 10, b = 20;
+    assert(mlappend(list, &a) == 0);
+    assert(mlappend(list, &b) == 0);
+    assert(list->length == 2 && list->header->length == 2);
+
+    int out;
+    assert(mlget(list, 0, &out) == 0 && out == 10);
+    assert(*(int*)mlat(list, 1) == 20);
+    assert((int*)mlat(list, 1) == (int*)mlat(list, 0) + 1);
+
+    mlprint(list, print_int);
+
+    assert(close_mapped_list(list) == 0);
+    unlink(path);
+}
+
+static void test_reopen_keeps_elements() {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    mapped_list* list = open_mapped_list(path, sizeof(record), 2);
+    for (int i = 0; i < 100; ++i) {
+        record r = {i, i + 0.5};
+        assert(mlappend(list, &r) == 0);
+    }
+    assert(list->max_size == 128);
+    assert(mlsync(list) == 0);
+    assert(close_mapped_list(list) == 0);
+
+    // the initial size is ignored for an existing file
+    list = open_mapped_list(path, sizeof(record), 4);
+    assert(list != NULL);
+    assert(list->length == 100 && list->max_size == 128);
+
+    record key = {42, 0}, out;
+    assert(mlget_index(list, &key, compare_record_id) == 42);
+    assert(mlget(list, 99, &out) == 0 && out.id == 99 && out.weight == 99.5);
+
+    assert(mldelete(list, 0, &out) == 0 && out.id == 0);
+    assert(close_mapped_list(list) == 0);
+
+    list = open_mapped_list(path, sizeof(record), 0);
+    assert(list->length == 99 && ((record*)mlat(list, 0))->id == 1);
+    assert(close_mapped_list(list) == 0);
+
+    unlink(path);
+}
+
+static void test_add_delete_reverse() {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    mapped_list* list = open_mapped_list(path, sizeof(long), 0);
+    assert(list->max_size == 10);
+
+    for (long i = 0; i < 5; ++i) mlappend(list, &i);
+    long v = 100;
+    assert(mladd(list, 2, &v) == 0);     // 0 1 100 2 3 4
+    assert(mladd(list, 0, &v) == 0);     // 100 0 1 100 2 3 4
+    assert(mladd(list, list->length, &v) == 0);
+    assert(list->length == 8);
+
+    // without a compare function the bytes are compared
+    assert(mlget_index(list, &v, NULL) == 0);
+
+    long out;
+    assert(mlpop(list, &out) == 0 && out == 100);
+    assert(mldelete(list, 0, NULL) == 0);
+    assert(mldelete(list, 2, &out) == 0 && out == 100);
+
+    mlreverse(list);
+    long expected[] = {4, 3, 2, 1, 0};
+    for (ssize_t i = 0; i < list->length; ++i) assert(*(long*)mlat(list, i) == expected[i]);
+
+    v = -1;
+    assert(mlset(list, 4, &v) == 0 && *(long*)mlat(list, 4) == -1);
+
+    close_mapped_list(list);
+    unlink(path);
+}
+
+static void test_large_elements_reverse() {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    // bigger than the swap chunk used by mlreverse
+    typedef struct { char bytes[300]; } big;
+    mapped_list* list = open_mapped_list(path, sizeof(big), 3);
+
+    big b;
+    for (int i = 0; i < 5; ++i) {
+        memset(b.bytes, 'a' + i, sizeof(b.bytes));
+        mlappend(list, &b);
+    }
+    mlreverse(list);
+    for (int i = 0; i < 5; ++i) {
+        big* p = mlat(list, i);
+        assert(p->bytes[0] == 'e' - i && p->bytes[299] == 'e' - i);
+    }
+
+    close_mapped_list(list);
+    unlink(path);
+}
+
+// ----------------- Edge cases -----------------
+
+static void test_null_and_invalid_inputs() {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    assert(open_mapped_list(NULL, 4, 10) == NULL);
+    assert(open_mapped_list(path, 0, 10) == NULL);
+    assert(open_mapped_list("/nonexistent_dir/list", 4, 10) == NULL);
+
+    mapped_list* list = open_mapped_list(path, sizeof(int), 1);
+    int x = 1, out;
+    assert(mlappend(NULL, &x) == -1);
+    assert(mlappend(list, NULL) == -1);
+    assert(mladd(list, -1, &x) == -1);
+    assert(mladd(list, 1, &x) == -1);
+    assert(mlget(list, 0, &out) == -1);
+    assert(mlset(list, 0, &x) == -1);
+    assert(mlat(list, 0) == NULL);
+    assert(mlpop(list, &out) == -1);
+    assert(mldelete(list, 0, NULL) == -1);
+    assert(mlget_index(list, &x, NULL) == -1);
+    assert(mlsync(NULL) == -1);
+    assert(close_mapped_list(NULL) == -1);
+    mlprint(NULL, print_int);
+    mlreverse(NULL);
+
+    assert(mlappend(list, &x) == 0);
+    assert(mlget(list, 0, NULL) == -1);
+    assert(close_mapped_list(list) == 0);
+
+    unlink(path);
+}
+
+// values read straight out of the mapping (mlat) while it grows and shifts
+static void test_self_insert() {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    mapped_list* list = open_mapped_list(path, sizeof(int), 2);
+    int a = 1, b = 2;
+    mlappend(list, &a);
+    mlappend(list, &b);
+
+    // full, so the mapping may move while element points into it
+    assert(mlappend(list, mlat(list, 0)) == 0);
+    assert(list->length == 3 && *(int*)mlat(list, 2) == 1);
+
+    // the shift moves the source past the insertion point: [1,2,1] -> [1,1,2,1]
+    assert(mladd(list, 1, mlat(list, 2)) == 0);
+    assert(*(int*)mlat(list, 1) == 1 && *(int*)mlat(list, 2) == 2 && *(int*)mlat(list, 3) == 1);
+
+    assert(close_mapped_list(list) == 0);
+    unlink(path);
+}
+
+static void test_rejects_foreign_files() {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    mapped_list* list = open_mapped_list(path, sizeof(int), 4);
+    int x = 7;
+    mlappend(list, &x);
+    close_mapped_list(list);
+
+    // another element size
+    assert(open_mapped_list(path, sizeof(long), 4) == NULL);
+
+    // not a mapped list
+    FILE* f = fopen(path, "r+");
+    fwrite("garbage!", 1, 8, f);
+    fclose(f);
+    assert(open_mapped_list(path, sizeof(int), 4) == NULL);
+
+    // shorter than a header
+    f = fopen(path, "w");
+    fwrite("x", 1, 1, f);
+    fclose(f);
+    assert(open_mapped_list(path, sizeof(int), 4) == NULL);
+
+    // an empty file is initialised like a new one
+    f = fopen(path, "w");
+    fclose(f);
+    list = open_mapped_list(path, sizeof(int), 4);
+    assert(list != NULL && list->length == 0 && list->max_size == 4);
+    close_mapped_list(list);
+
+    unlink(path);
+}
+
+// ----------------- Stress test -----------------
+
+static void test_stress_operations() {
+    char path[64];
+    temp_path(path, sizeof(path));
+
+    const long N = 200000;
+    mapped_list* list = open_mapped_list(path, sizeof(long), 1);
+    for (long i = 0; i < N; ++i) assert(mlappend(list, &i) == 0);
+    assert(list->length == N);
+
+    for (long i = 0; i < 10; ++i) assert(mldelete(list, 10, NULL) == 0);
+    assert(*(long*)mlat(list, 10) == 20);
+    assert(close_mapped_list(list) == 0);
+
+    list = open_mapped_list(path, sizeof(long), 1);
+    assert(list->length == N - 10);
+    for (ssize_t i = 10; i < list->length; ++i) assert(*(long*)mlat(list, i) == i + 10);
+    close_mapped_list(list);
+
+    unlink(path);
+}
+
+int main(void) {
+    // Normal
+    test_open_and_append();
+    test_reopen_keeps_elements();
+    test_add_delete_reverse();
+    test_large_elements_reverse();
+
+    // Edge
+    test_null_and_invalid_inputs();
+    test_rejects_foreign_files();
+    test_self_insert();
+
+    // Stress
+    test_stress_operations();
+
+    printf("✅ All mapped_list tests passed!\n");
+    return 0;
+}
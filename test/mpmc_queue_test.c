@@ -0,0 +1,170 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <assert.h>
+#include <pthread.h>
+#include "../mpmc_queue.h"
+
+// ----------------- Helpers -----------------
+
+static int* make_element_int(int v) {
+    int* p = malloc(sizeof(int));
+    assert(p != NULL);
+    *p = v;
+    return p;
+}
+
+static void free_int(void* p) {
+    free(p);
+}
+
+// elements are encoded as non-NULL integers so the threaded test allocates nothing
+#define TO_ELEMENT(i) ((void*)(uintptr_t)((i) + 1))
+#define FROM_ELEMENT(p) ((long)(uintptr_t)(p) - 1)
+
+// ----------------- Normal usage tests -----------------
+
+static void test_enqueue_dequeue_front() {
+    mpmc_queue* qu = create_mpmc_queue(4);
+    assert(qu != NULL);
+    assert(qu->mask == 3);
+
+    assert(mpmc_enqueue(qu, make_element_int(10)) == 0);
+    assert(mpmc_try_enqueue(qu, make_element_int(20)) == 0);
+    assert(mpmc_queue_size(qu) == 2);
+
+    int* front = (int*)mpmc_queue_front(qu);
+    assert(front && *front == 10);
+
+    int* deq = (int*)mpmc_dequeue(qu);
+    assert(deq && *deq == 10);
+    free(deq);
+
+    deq = (int*)mpmc_try_dequeue(qu);
+    assert(deq && *deq == 20);
+    free(deq);
+
+    assert(mpmc_try_dequeue(qu) == NULL);
+    assert(mpmc_queue_front(qu) == NULL);
+    assert(mpmc_queue_size(qu) == 0);
+
+    assert(free_mpmc_queue(qu, free_int) == 0);
+}
+
+static void test_full_queue_and_wraparound() {
+    mpmc_queue* qu = create_mpmc_queue(3);
+    assert(qu != NULL && qu->mask == 3);
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i) assert(mpmc_try_enqueue(qu, TO_ELEMENT(i)) == 0);
+        assert(mpmc_try_enqueue(qu, TO_ELEMENT(4)) == -1);
+
+        for (int i = 0; i < 4; ++i) assert(FROM_ELEMENT(mpmc_try_dequeue(qu)) == i);
+        assert(mpmc_try_dequeue(qu) == NULL);
+    }
+
+    assert(free_mpmc_queue(qu, NULL) == 0);
+}
+
+// ----------------- Edge cases -----------------
+
+static void test_null_and_invalid_inputs() {
+    int* num = make_element_int(1);
+
+    assert(mpmc_try_enqueue(NULL, num) == -1);
+    assert(mpmc_enqueue(NULL, num) == -1);
+    assert(mpmc_try_dequeue(NULL) == NULL);
+    assert(mpmc_dequeue(NULL) == NULL);
+    assert(mpmc_queue_front(NULL) == NULL);
+    assert(mpmc_queue_size(NULL) == -1);
+    assert(free_mpmc_queue(NULL, free_int) == -1);
+    // the slot array size would overflow
+    assert(create_mpmc_queue(SSIZE_MAX) == NULL);
+
+    mpmc_queue* qu = create_mpmc_queue(1);
+    assert(qu != NULL && qu->mask == 1023);
+    assert(mpmc_try_enqueue(qu, NULL) == -1);
+    assert(mpmc_enqueue(qu, NULL) == -1);
+
+    // elements left in the queue are freed with it
+    assert(mpmc_enqueue(qu, num) == 0);
+    assert(free_mpmc_queue(qu, free_int) == 0);
+}
+
+// ----------------- Multi-threaded test -----------------
+
+#define PRODUCERS 4
+#define CONSUMERS 4
+#define PER_PRODUCER 100000L
+
+typedef struct {
+    mpmc_queue* qu;
+    long id;
+    long sum;
+    long count;
+    long last_seen[PRODUCERS];
+} worker_arg;
+
+static void* producer(void* arg) {
+    worker_arg* w = arg;
+    // encode the producer id so consumers can check per-producer FIFO order
+    for (long i = 0; i < PER_PRODUCER; ++i)
+        assert(mpmc_enqueue(w->qu, TO_ELEMENT(i * PRODUCERS + w->id)) == 0);
+    return NULL;
+}
+
+static void* consumer(void* arg) {
+    worker_arg* w = arg;
+    for (int p = 0; p < PRODUCERS; ++p) w->last_seen[p] = -1;
+
+    for (long i = 0; i < PRODUCERS * PER_PRODUCER / CONSUMERS; ++i) {
+        long v = FROM_ELEMENT(mpmc_dequeue(w->qu));
+        long from = v % PRODUCERS, seq = v / PRODUCERS;
+        assert(seq > w->last_seen[from]);
+        w->last_seen[from] = seq;
+        w->sum += v;
+        w->count++;
+    }
+    return NULL;
+}
+
+static void test_many_producers_many_consumers() {
+    mpmc_queue* qu = create_mpmc_queue(256);
+    pthread_t threads[PRODUCERS + CONSUMERS];
+    worker_arg args[PRODUCERS + CONSUMERS] = {0};
+
+    for (long i = 0; i < PRODUCERS + CONSUMERS; ++i) {
+        args[i].qu = qu;
+        args[i].id = (i < PRODUCERS ? i : i - PRODUCERS);
+        assert(pthread_create(&threads[i], NULL, i < PRODUCERS ? producer : consumer, &args[i]) == 0);
+    }
+    for (int i = 0; i < PRODUCERS + CONSUMERS; ++i) pthread_join(threads[i], NULL);
+
+    // every element was dequeued exactly once
+    long total = PRODUCERS * PER_PRODUCER, sum = 0, count = 0;
+    for (int i = PRODUCERS; i < PRODUCERS + CONSUMERS; ++i) {
+        sum += args[i].sum;
+        count += args[i].count;
+    }
+    assert(count == total);
+    assert(sum == total * (total - 1) / 2);
+    assert(mpmc_try_dequeue(qu) == NULL);
+
+    free_mpmc_queue(qu, NULL);
+}
+
+int main(void) {
+    // Normal
+    test_enqueue_dequeue_front();
+    test_full_queue_and_wraparound();
+
+    // Edge
+    test_null_and_invalid_inputs();
+
+    // Threads
+    test_many_producers_many_consumers();
+
+    printf("✅ All mpmc_queue tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,156 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <limits.h>
+#include <sys/types.h>
+#include "../node_pool.h"
+#include "../linked_list.h"
+
+// ----------------- Helpers -----------------
+
+static int* make_element_int(int v) {
+    int* p = malloc(sizeof(int));
+    assert(p != NULL);
+    *p = v;
+    return p;
+}
+
+static void free_int(void* p) {
+    free(p);
+}
+
+// ----------------- Normal usage tests -----------------
+
+static void test_alloc_and_reuse() {
+    node_pool* pool = create_node_pool(4);
+    assert(pool != NULL);
+    assert(pool->slab_size == 4 && pool->in_use == 0);
+
+    int a = 1, b = 2;
+    node* n1 = pool_alloc_node(pool, &a);
+    node* n2 = pool_alloc_node(pool, &b);
+    assert(n1 && n2 && n1 != n2);
+    assert(n1->value == &a && n1->next == NULL);
+    assert(pool->in_use == 2);
+
+    // nodes of one slab are contiguous
+    assert(n2 == n1 + 1);
+
+    // a released node is handed out again before the slab advances
+    pool_free_node(pool, n1);
+    assert(pool->in_use == 1);
+    node* n3 = pool_alloc_node(pool, &b);
+    assert(n3 == n1 && n3->value == &b);
+
+    free_node_pool(pool);
+}
+
+static void test_pooled_list_operations() {
+    linked_list* list = create_pooled_linked_list(NULL);
+    assert(list != NULL && list->pool != NULL && list->owns_pool);
+
+    for (int i = 0; i < 10; ++i) assert(llappend(list, make_element_int(i)) == 0);
+    assert(lladd(list, 0, make_element_int(-1)) == 0);
+    assert(lladd(list, 5, make_element_int(100)) == 0);
+    assert(list->length == 12);
+    assert(list->pool->in_use == 12);
+
+    int* v = (int*)llget(list, 5);
+    assert(v && *v == 100);
+
+    assert(lldelete(list, 5, free_int) == 0);
+    assert(lldelete(list, 0, free_int) == 0);
+    assert(llpop(list, free_int) == 0);
+    assert(list->length == 9);
+    assert(list->pool->in_use == 9);
+
+    llreverse(list);
+    v = (int*)llget(list, 0);
+    assert(v && *v == 8);
+
+    assert(free_linked_list(list, free_int) == 0);
+}
+
+static void test_shared_pool() {
+    node_pool* pool = create_node_pool(8);
+    assert(pool != NULL);
+
+    linked_list* l1 = create_pooled_linked_list(pool);
+    linked_list* l2 = create_pooled_linked_list(pool);
+    assert(l1 && l2 && !l1->owns_pool && !l2->owns_pool);
+
+    for (int i = 0; i < 20; ++i) {
+        assert(llappend(l1, make_element_int(i)) == 0);
+        assert(llappend(l2, make_element_int(i)) == 0);
+    }
+    assert(pool->in_use == 40);
+
+    // freeing a list using a shared pool hands its nodes back to the pool
+    assert(free_linked_list(l1, free_int) == 0);
+    assert(pool->in_use == 20);
+
+    int* v = (int*)llget(l2, 19);
+    assert(v && *v == 19);
+
+    assert(free_linked_list(l2, free_int) == 0);
+    assert(pool->in_use == 0);
+
+    free_node_pool(pool);
+}
+
+// ----------------- Edge cases -----------------
+
+static void test_null_and_invalid_inputs() {
+    int a = 1;
+
+    assert(pool_alloc_node(NULL, &a) == NULL);
+    pool_free_node(NULL, NULL);
+    free_node_pool(NULL);
+
+    node_pool* pool = create_node_pool(0);
+    assert(pool != NULL && pool->slab_size == 64);
+    assert(pool_alloc_node(pool, NULL) == NULL);
+    assert(pool->in_use == 0);
+    pool_free_node(pool, NULL);
+
+    free_node_pool(pool);
+
+    // the slab byte count would overflow
+    assert(create_node_pool(SSIZE_MAX) == NULL);
+}
+
+// ----------------- Stress test -----------------
+
+static void test_stress_operations() {
+    linked_list* list = create_pooled_linked_list(NULL);
+    const int N = 1000;
+
+    for (int i = 0; i < N; ++i) assert(llappend(list, make_element_int(i)) == 0);
+
+    // drain and refill to exercise the free list across several slabs
+    for (int i = 0; i < N / 2; ++i) assert(lldelete(list, 0, free_int) == 0);
+    for (int i = 0; i < N / 2; ++i) assert(llappend(list, make_element_int(i)) == 0);
+    assert(list->length == N);
+    assert(list->pool->in_use == N);
+
+    int* first = (int*)llget(list, 0);
+    assert(first && *first == N / 2);
+
+    assert(free_linked_list(list, free_int) == 0);
+}
+
+int main(void) {
+    // Normal
+    test_alloc_and_reuse();
+    test_pooled_list_operations();
+    test_shared_pool();
+
+    // Edge
+    test_null_and_invalid_inputs();
+
+    // Stress
+    test_stress_operations();
+
+    printf("✅ All node_pool tests passed!\n");
+    return 0;
+}
@@ -1,6 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <string.h>
+#include <dirent.h>
 #include "../queue.h"
 
 // ----------------- Helpers -----------------
@@ -16,6 +18,39 @@ static void free_int(void* p) {
     free(p);
 }
 
+static ssize_t serialize_int(void* element, void* buffer, size_t capacity) {
+    if (capacity < sizeof(int)) return sizeof(int);
+    memcpy(buffer, element, sizeof(int));
+    return sizeof(int);
+}
+
+static void* deserialize_int(const void* buffer, size_t size) {
+    if (size != sizeof(int)) return NULL;
+    int v;
+    memcpy(&v, buffer, sizeof(int));
+    return make_element_int(v);
+}
+
+// strings, to spill records of varying size
+static ssize_t serialize_str(void* element, void* buffer, size_t capacity) {
+    size_t n = strlen(element);
+    if (n <= capacity) memcpy(buffer, element, n);
+    return (ssize_t)n;
+}
+
+static void* deserialize_str(const void* buffer, size_t size) {
+    char* s = malloc(size + 1);
+    assert(s != NULL);
+    memcpy(s, buffer, size);
+    s[size] = '\0';
+    return s;
+}
+
+static queue_spill_config int_spill_config(ssize_t budget, size_t segment_size) {
+    queue_spill_config config = {budget, NULL, segment_size, serialize_int, deserialize_int, free_int};
+    return config;
+}
+
 // ----------------- Normal usage tests -----------------
 
 static void test_enqueue_dequeue_front() {
@@ -55,6 +90,140 @@ static void test_enqueue_dequeue_front() {
     free_queue(qu, free_int);
 }
 
+static void test_ring_buffer_backend() {
+    queue* qu = create_queue_backend(QUEUE_RING_BUFFER, 3);
+    assert(qu != NULL);
+    assert(qu->backend == QUEUE_RING_BUFFER && qu->ring->capacity == 4);
+
+    // fill, drain half and refill so the elements wrap around the ring
+    for (int i = 0; i < 4; ++i) assert(enqueue(qu, make_element_int(i)) == 0);
+    for (int i = 0; i < 2; ++i) {
+        int* deq = (int*)dequeue(qu);
+        assert(deq && *deq == i);
+        free(deq);
+    }
+    for (int i = 4; i < 6; ++i) assert(enqueue(qu, make_element_int(i)) == 0);
+    assert(qu->ring->capacity == 4 && qu->ring->head == 2);
+
+    // growing a wrapped ring keeps FIFO order
+    assert(enqueue(qu, make_element_int(6)) == 0);
+    assert(qu->ring->capacity == 8 && qu->ring->length == 5);
+
+    int* front = (int*)queue_front(qu);
+    assert(front && *front == 2);
+
+    for (int i = 2; i < 7; ++i) {
+        int* deq = (int*)dequeue(qu);
+        assert(deq && *deq == i);
+        free(deq);
+    }
+    assert(dequeue(qu) == NULL);
+    assert(queue_front(qu) == NULL);
+
+    // elements left in the ring are freed with the queue
+    assert(enqueue(qu, make_element_int(7)) == 0);
+    assert(free_queue(qu, free_int) == 0);
+}
+
+static void test_batches(queue* qu) {
+    void* batch[40];
+    void* out[40];
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 40; ++i) batch[i] = make_element_int(round * 100 + i);
+        assert(enqueue_batch(qu, batch, 40) == 0);
+
+        // drain in uneven chunks so the ring wraps between rounds
+        ssize_t got = dequeue_batch(qu, out, 25);
+        assert(got == 25);
+        for (int i = 0; i < 25; ++i) {
+            assert(*(int*)out[i] == round * 100 + i);
+            free(out[i]);
+        }
+        got = dequeue_batch(qu, out, 40);
+        assert(got == 15);
+        for (int i = 0; i < 15; ++i) {
+            assert(*(int*)out[i] == round * 100 + 25 + i);
+            free(out[i]);
+        }
+    }
+
+    assert(dequeue_batch(qu, out, 5) == 0);
+    assert(queue_front(qu) == NULL);
+
+    void* with_null[2] = {batch[0], NULL};
+    assert(enqueue_batch(qu, batch, 0) == 0);
+    assert(enqueue_batch(NULL, batch, 1) == -1);
+    assert(dequeue_batch(NULL, out, 1) == -1);
+    assert(dequeue_batch(qu, out, -1) == -1);
+    if (qu->backend == QUEUE_RING_BUFFER) assert(enqueue_batch(qu, with_null, 2) == -1);
+    else assert(enqueue_batch(qu, with_null, 2) == -1 && qu->list->length == 0);
+
+    free_queue(qu, free_int);
+}
+
+static void test_spilling_backend() {
+    queue_spill_config config = int_spill_config(4, 0);
+    queue* qu = create_spilling_queue(&config);
+    assert(qu != NULL && qu->backend == QUEUE_SPILLING);
+
+    for (int i = 0; i < 10; ++i) assert(enqueue(qu, make_element_int(i)) == 0);
+
+    // only the budget stays in memory, the rest went to disk
+    assert(qu->ring->length == 4 && qu->spill->count == 6);
+
+    for (int i = 0; i < 5; ++i) {
+        int* val = (int*)dequeue(qu);
+        assert(val && *val == i);
+        free(val);
+    }
+    // the ring was refilled from disk in one go
+    assert(qu->ring->length == 3 && qu->spill->count == 2);
+
+    // FIFO holds while the spilled tail drains: new elements queue up behind it
+    assert(enqueue(qu, make_element_int(10)) == 0);
+    assert(qu->spill->count == 3);
+    assert(*(int*)queue_front(qu) == 5);
+
+    void* out[16];
+    assert(dequeue_batch(qu, out, 16) == 6);
+    for (int i = 0; i < 6; ++i) {
+        assert(*(int*)out[i] == 5 + i);
+        free(out[i]);
+    }
+    assert(dequeue(qu) == NULL && queue_front(qu) == NULL);
+
+    // once drained, elements stay in memory again
+    void* batch[3] = {make_element_int(1), make_element_int(2), make_element_int(3)};
+    assert(enqueue_batch(qu, batch, 3) == 0);
+    assert(qu->ring->length == 3 && qu->spill->count == 0);
+
+    free_queue(qu, free_int);
+
+    // records of varying size, some larger than the serialize buffer
+    config.serialize = serialize_str;
+    config.deserialize = deserialize_str;
+    config.memory_budget = 2;
+    qu = create_spilling_queue(&config);
+    for (int i = 0; i < 20; ++i) {
+        char* s = malloc(1000);
+        memset(s, 'a' + i, (size_t)i * 50);
+        s[i * 50] = '\0';
+        assert(enqueue(qu, s) == 0);
+    }
+    for (int i = 0; i < 20; ++i) {
+        char* s = dequeue(qu);
+        assert(s && strlen(s) == (size_t)i * 50 && (i == 0 || s[0] == 'a' + i));
+        free(s);
+    }
+    free_queue(qu, free_int);
+}
+
+static void test_batch_operations() {
+    test_batches(create_queue());
+    test_batches(create_queue_backend(QUEUE_RING_BUFFER, 8));
+}
+
 // ----------------- Edge cases -----------------
 
 static void test_null_and_empty_queue() {
@@ -70,6 +239,13 @@ static void test_null_and_empty_queue() {
     queue* qu = create_queue();
     assert(qu != NULL);
     assert(free_queue(qu, free_int) == 0);
+
+    // Ring buffer rejects NULL elements and defaults its capacity
+    qu = create_queue_backend(QUEUE_RING_BUFFER, 0);
+    assert(qu != NULL && qu->ring->capacity == 16);
+    assert(enqueue(qu, NULL) == -1);
+    assert(dequeue(qu) == NULL);
+    assert(free_queue(qu, free_int) == 0);
 }
 
 static void test_free_element_null() {
@@ -85,6 +261,31 @@ static void test_free_element_null() {
     free(a); // manual free because free_element=NULL
 }
 
+static void test_spilling_config() {
+    queue_spill_config config = int_spill_config(4, 0);
+    assert(create_queue_backend(QUEUE_SPILLING, 4) == NULL);
+    assert(create_spilling_queue(NULL) == NULL);
+
+    config.serialize = NULL;
+    assert(create_spilling_queue(&config) == NULL);
+    config = int_spill_config(4, 0);
+    config.deserialize = NULL;
+    assert(create_spilling_queue(&config) == NULL);
+
+    // spilled elements are dropped with their files on free
+    config = int_spill_config(0, 0);
+    queue* qu = create_spilling_queue(&config);
+    assert(qu != NULL && qu->spill_config.memory_budget == 1024);
+    for (int i = 0; i < 1500; ++i) assert(enqueue(qu, make_element_int(i)) == 0);
+    assert(qu->ring->length == 1024 && qu->spill->count == 476);
+    assert(enqueue(qu, NULL) == -1);
+
+    char dir[4096];
+    snprintf(dir, sizeof(dir), "%s", qu->spill->dir);
+    assert(free_queue(qu, free_int) == 0);
+    assert(opendir(dir) == NULL);
+}
+
 // ----------------- Stress test -----------------
 
 static void test_stress_operations() {
@@ -108,15 +309,60 @@ static void test_stress_operations() {
     // Queue empty now
     assert(dequeue(qu) == NULL);
     free_queue(qu, free_int);
+
+    // Same FIFO contract on the ring buffer, interleaving to keep it wrapping
+    qu = create_queue_backend(QUEUE_RING_BUFFER, 8);
+    int next_out = 0;
+    for (int i=0; i<N; ++i) {
+        assert(enqueue(qu, make_element_int(i)) == 0);
+        if (i % 3 == 0) {
+            int* val = (int*)dequeue(qu);
+            assert(val && *val == next_out++);
+            free(val);
+        }
+    }
+    while (next_out < N) {
+        int* val = (int*)dequeue(qu);
+        assert(val && *val == next_out++);
+        free(val);
+    }
+    assert(dequeue(qu) == NULL);
+    free_queue(qu, free_int);
+
+    // spilling with tiny segments so the reader keeps crossing files
+    queue_spill_config config = int_spill_config(64, 256);
+    qu = create_spilling_queue(&config);
+    const int M = 100000;
+    next_out = 0;
+    for (int i = 0; i < M; ++i) {
+        assert(enqueue(qu, make_element_int(i)) == 0);
+        if (i % 4 == 0) {
+            int* val = (int*)dequeue(qu);
+            assert(val && *val == next_out++);
+            free(val);
+        }
+    }
+    assert(qu->ring->length <= 64);
+    while (next_out < M) {
+        int* val = (int*)dequeue(qu);
+        assert(val && *val == next_out++);
+        free(val);
+    }
+    assert(dequeue(qu) == NULL);
+    free_queue(qu, free_int);
 }
 
 int main(void) {
     // Normal
     test_enqueue_dequeue_front();
+    test_ring_buffer_backend();
+    test_spilling_backend();
+    test_batch_operations();
 
     // Edge
     test_null_and_empty_queue();
     test_free_element_null();
+    test_spilling_config();
 
     // Stress
     test_stress_operations();
@@ -0,0 +1,256 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <sys/types.h>
+#include "../skip_list.h"
+
+// ----------------- Helper functions -----------------
+
+static int *make_element_int(int v) {
+    int *p = malloc(sizeof(int));
+    assert(p != NULL);
+    *p = v;
+    return p;
+}
+
+static void free_int(void *p) {
+    free(p);
+}
+
+static int compare_int(void *a, void *b) {
+    if (a == NULL || b == NULL) return -1;
+    return (*(int*)a == *(int*)b) ? 0 : -1;
+}
+
+static void print_int(void *p) {
+    if (p == NULL) return;
+    printf("[%d]", *(int*)p);
+}
+
+// checks the prev chain and that every lane's widths add up to the positions on the bottom lane
+static void check_invariants(const skip_list *list) {
+    ssize_t length = 0;
+    skip_node *prev = NULL;
+    for (skip_node *n = list->head->links[0].next; n != NULL; n = n->links[0].next) {
+        assert(n->prev == prev);
+        assert(n->links[0].width == 1);
+        assert(n->level >= 1 && n->level <= list->level);
+        prev = n;
+        length++;
+    }
+    assert(list->tail == prev);
+    assert(length == list->length);
+
+    for (int i = 0; i < list->level; ++i) {
+        ssize_t position = 0;
+        skip_node *n = list->head;
+        while (n->links[i].next != NULL) {
+            position += n->links[i].width;
+            n = n->links[i].next;
+            assert(slget_node(list, position - 1) == n);
+        }
+        assert(position + n->links[i].width == list->length + 1);
+    }
+}
+
+// ----------------- Tests -----------------
+
+static void test_create_and_append() {
+    skip_list *list = create_skip_list();
+    assert(list != NULL);
+    assert(list->length == 0 && list->tail == NULL && list->level == 1);
+
+    assert(slappend(list, make_element_int(10)) == 0);
+    assert(slappend(list, make_element_int(20)) == 0);
+    assert(list->length == 2);
+    check_invariants(list);
+
+    int *a = (int *)slget(list, 0);
+    int *b = (int *)slget(list, 1);
+    assert(a != NULL && b != NULL);
+    assert(*a == 10 && *b == 20);
+    assert(slget_node(list, 1) == list->tail);
+
+    free_skip_list(list, free_int);
+}
+
+static void test_add_set_get() {
+    skip_list *list = create_skip_list();
+
+    assert(slappend(list, make_element_int(1)) == 0);
+    assert(slappend(list, make_element_int(3)) == 0);
+
+    // Insert 2 at index 1 → [1,2,3], then 0 at the front → [0,1,2,3]
+    assert(sladd(list, 1, make_element_int(2)) == 0);
+    assert(sladd(list, 0, make_element_int(0)) == 0);
+    assert(list->length == 4);
+    check_invariants(list);
+    for (int i = 0; i < 4; ++i) {
+        int *val = (int *)slget(list, i);
+        assert(val != NULL && *val == i);
+    }
+
+    assert(slset(list, 1, make_element_int(42), free_int) == 0);
+    int *val = (int *)slget(list, 1);
+    assert(val != NULL && *val == 42);
+
+    free_skip_list(list, free_int);
+}
+
+static void test_index_delete() {
+    skip_list *list = create_skip_list();
+
+    assert(slappend(list, make_element_int(5)) == 0);
+    assert(slappend(list, make_element_int(10)) == 0);
+    assert(slappend(list, make_element_int(15)) == 0);
+
+    int target = 10;
+    assert(slget_index(list, &target, compare_int) == 1);
+
+    // Delete index 1 → [5,15]
+    assert(sldelete(list, 1, free_int) == 0);
+    assert(list->length == 2);
+    check_invariants(list);
+    int *val = (int *)slget(list, 1);
+    assert(val != NULL && *val == 15);
+    assert(slget_index(list, &target, compare_int) == -1);
+
+    free_skip_list(list, free_int);
+}
+
+static void test_pop_reverse() {
+    skip_list *list = create_skip_list();
+    const int N = 1001;
+
+    for (int i = 0; i < N; ++i) assert(slappend(list, make_element_int(i)) == 0);
+    check_invariants(list);
+    assert(list->level > 1);
+
+    slreverse(list);
+    check_invariants(list);
+    for (int i = 0; i < N; ++i) {
+        int *v = (int *)slget(list, i);
+        assert(v != NULL && *v == N - 1 - i);
+    }
+
+    // Pop last → removes 0
+    assert(slpop(list, free_int) == 0);
+    assert(list->length == N - 1);
+    int *last = (int *)slget(list, list->length - 1);
+    assert(last != NULL && *last == 1);
+    check_invariants(list);
+
+    free_skip_list(list, free_int);
+}
+
+// ----------------- Edge Case Tests -----------------
+
+static void test_null_and_invalid_inputs() {
+    skip_list *list = create_skip_list();
+    int *p = make_element_int(2);
+    int *q = make_element_int(5);
+
+    assert(slappend(NULL, p) == -1);
+    assert(sladd(NULL, 0, p) == -1);
+    assert(slset(NULL, 0, q, free_int) == -1);
+    assert(slget_index(NULL, p, compare_int) == -1);
+    assert(slget_index(list, p, NULL) == -1);
+    assert(slget(NULL, 0) == NULL);
+    assert(slget_node(NULL, 0) == NULL);
+    assert(sldelete(NULL, 0, free_int) == -1);
+    assert(slpop(NULL, free_int) == -1);
+    assert(free_skip_list(NULL, free_int) == -1);
+    slreverse(NULL);
+    slprint(NULL, print_int);
+
+    assert(slappend(list, NULL) == -1);
+    assert(slappend(list, q) == 0);
+    assert(slget(list, -1) == NULL);
+    assert(slget(list, 1) == NULL);
+    assert(sladd(list, 2, q) == -1);
+    assert(sladd(list, -1, q) == -1);
+    assert(sldelete(list, 1, free_int) == -1);
+    assert(slset(list, 1, p, free_int) == -1);
+    assert(slset(list, 0, NULL, free_int) == -1);
+    check_invariants(list);
+
+    free(p);
+    free_skip_list(list, free_int);
+}
+
+static void test_empty_list_operations() {
+    skip_list *list = create_skip_list();
+
+    assert(slpop(list, free_int) == -1);
+    assert(sldelete(list, 0, free_int) == -1);
+    slreverse(list);
+    slprint(list, print_int);
+
+    // emptying a list drops the lanes it no longer needs
+    for (int i = 0; i < 200; ++i) assert(slappend(list, make_element_int(i)) == 0);
+    while (list->length > 0) assert(slpop(list, free_int) == 0);
+    assert(list->tail == NULL && list->head->links[0].next == NULL && list->level == 1);
+    check_invariants(list);
+
+    free_skip_list(list, free_int);
+}
+
+// ----------------- Stress test -----------------
+
+// random edits mirrored on a plain array
+static void test_stress_against_array() {
+    skip_list *list = create_skip_list();
+    enum { MAX = 2000 };
+    static int reference[MAX];
+    ssize_t length = 0;
+    srand(42);
+
+    for (int step = 0; step < 20000; ++step) {
+        int op = rand() % 4;
+        if ((op <= 1 || length == 0) && length < MAX) {
+            ssize_t idx = rand() % (length + 1);
+            int v = rand();
+            assert(sladd(list, idx, make_element_int(v)) == 0);
+            for (ssize_t i = length; i > idx; --i) reference[i] = reference[i - 1];
+            reference[idx] = v;
+            length++;
+        } else if (op == 2 && length > 0) {
+            ssize_t idx = rand() % length;
+            assert(sldelete(list, idx, free_int) == 0);
+            for (ssize_t i = idx; i < length - 1; ++i) reference[i] = reference[i + 1];
+            length--;
+        } else if (length > 0) {
+            ssize_t idx = rand() % length;
+            int *v = (int *)slget(list, idx);
+            assert(v && *v == reference[idx]);
+        }
+        if (step % 1000 == 0) check_invariants(list);
+    }
+
+    check_invariants(list);
+    assert(list->length == length);
+    for (ssize_t i = 0; i < length; ++i) {
+        int *v = (int *)slget(list, i);
+        assert(v && *v == reference[i]);
+    }
+
+    free_skip_list(list, free_int);
+}
+
+int main(void) {
+    // Normal operations
+    test_create_and_append();
+    test_add_set_get();
+    test_index_delete();
+    test_pop_reverse();
+
+    // Edge cases
+    test_null_and_invalid_inputs();
+    test_empty_list_operations();
+
+    // Stress
+    test_stress_against_array();
+
+    printf("✅ All skip_list tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/types.h>
+#include "../spill_fifo.h"
+
+// ----------------- Helpers functions -----------------
+
+static ssize_t count_segments(const char* dir) {
+    DIR* d = opendir(dir);
+    assert(d != NULL);
+    ssize_t n = 0;
+    struct dirent* e;
+    while ((e = readdir(d)) != NULL)
+        if (strstr(e->d_name, ".seg") != NULL) n++;
+    closedir(d);
+    return n;
+}
+
+static int front_int(spill_fifo* sf) {
+    const void* data;
+    int v;
+    assert(sffront(sf, &data) == sizeof(int));
+    memcpy(&v, data, sizeof(int));
+    return v;
+}
+
+// ----------------- Normal usage tests -----------------
+
+static void test_push_front_pop() {
+    spill_fifo* sf = create_spill_fifo(NULL, 0);
+    assert(sf != NULL && sf->count == 0 && sf->segment_size == 4 * 1024 * 1024);
+
+    for (int i = 0; i < 100; ++i) assert(sfpush(sf, &i, sizeof(int)) == 0);
+    assert(sf->count == 100);
+
+    // nothing reached the disk yet, the first read takes the buffered segment
+    assert(count_segments(sf->dir) == 0);
+    assert(front_int(sf) == 0);
+    assert(front_int(sf) == 0);
+    assert(sf->write_seq == 1);
+
+    for (int i = 0; i < 100; ++i) {
+        assert(front_int(sf) == i);
+        assert(sfpop(sf) == 0);
+    }
+    assert(sf->count == 0);
+
+    const void* data;
+    assert(sffront(sf, &data) == -1);
+    assert(sfpop(sf) == -1);
+
+    assert(free_spill_fifo(sf) == 0);
+}
+
+static void test_segments_are_rotated_and_deleted() {
+    spill_fifo* sf = create_spill_fifo("/tmp", 64);
+    char record[28];
+
+    // 32 bytes per record, two per segment
+    for (int i = 0; i < 10; ++i) {
+        memset(record, 'a' + i, sizeof(record));
+        assert(sfpush(sf, record, sizeof(record)) == 0);
+    }
+    assert(sf->write_seq == 4);
+
+    for (int i = 0; i < 10; ++i) {
+        const void* data;
+        assert(sffront(sf, &data) == sizeof(record));
+        assert(((const char*)data)[0] == 'a' + i && ((const char*)data)[27] == 'a' + i);
+        assert(sfpop(sf) == 0);
+
+        // a segment is deleted once the reader moves past it
+        assert(count_segments(sf->dir) <= 5 - i / 2);
+    }
+
+    char dir[4096];
+    snprintf(dir, sizeof(dir), "%s", sf->dir);
+    assert(free_spill_fifo(sf) == 0);
+    assert(opendir(dir) == NULL);
+}
+
+// ----------------- Edge cases -----------------
+
+static void test_null_and_invalid_inputs() {
+    assert(create_spill_fifo("/nonexistent_dir", 0) == NULL);
+    assert(free_spill_fifo(NULL) == -1);
+    assert(sfpush(NULL, "x", 1) == -1);
+    assert(sfpop(NULL) == -1);
+
+    spill_fifo* sf = create_spill_fifo(NULL, 0);
+    const void* data;
+    assert(sfpush(sf, NULL, 1) == -1);
+    assert(sffront(sf, NULL) == -1);
+
+    // empty records and records bigger than the buffers
+    assert(sfpush(sf, NULL, 0) == 0);
+    size_t big_size = 200 * 1024;
+    char* big = malloc(big_size);
+    memset(big, 'z', big_size);
+    assert(sfpush(sf, big, big_size) == 0);
+
+    assert(sffront(sf, &data) == 0 && sfpop(sf) == 0);
+    assert(sffront(sf, &data) == (ssize_t)big_size);
+    assert(memcmp(data, big, big_size) == 0);
+
+    // records left in the fifo are discarded on free
+    assert(free_spill_fifo(sf) == 0);
+    free(big);
+}
+
+// ----------------- Stress test -----------------
+
+static void test_stress_operations() {
+    spill_fifo* sf = create_spill_fifo(NULL, 4096);
+    int next_out = 0;
+
+    for (int i = 0; i < 200000; ++i) {
+        assert(sfpush(sf, &i, sizeof(int)) == 0);
+        if (i % 3 == 0) {
+            assert(front_int(sf) == next_out++);
+            assert(sfpop(sf) == 0);
+        }
+    }
+    while (sf->count > 0) {
+        assert(front_int(sf) == next_out++);
+        assert(sfpop(sf) == 0);
+    }
+    assert(next_out == 200000);
+    assert(count_segments(sf->dir) <= 1);
+
+    assert(free_spill_fifo(sf) == 0);
+}
+
+int main(void) {
+    // Normal
+    test_push_front_pop();
+    test_segments_are_rotated_and_deleted();
+
+    // Edge
+    test_null_and_invalid_inputs();
+
+    // Stress
+    test_stress_operations();
+
+    printf("✅ All spill_fifo tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,214 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <limits.h>
+#include <assert.h>
+#include <pthread.h>
+#include <time.h>
+#include <sched.h>
+#include "../spsc_queue.h"
+
+// ----------------- Helpers -----------------
+
+static int* make_element_int(int v) {
+    int* p = malloc(sizeof(int));
+    assert(p != NULL);
+    *p = v;
+    return p;
+}
+
+static void free_int(void* p) {
+    free(p);
+}
+
+// elements are encoded as non-NULL integers so the throughput test allocates nothing
+#define TO_ELEMENT(i) ((void*)(uintptr_t)((i) + 1))
+#define FROM_ELEMENT(p) ((long)(uintptr_t)(p) - 1)
+
+// ----------------- Normal usage tests -----------------
+
+static void test_enqueue_dequeue_front() {
+    spsc_queue* qu = create_spsc_queue(4);
+    assert(qu != NULL);
+    assert(qu->mask == 3);
+
+    assert(spsc_enqueue(qu, make_element_int(10)) == 0);
+    assert(spsc_try_enqueue(qu, make_element_int(20)) == 0);
+    assert(spsc_queue_size(qu) == 2);
+
+    int* front = (int*)spsc_queue_front(qu);
+    assert(front && *front == 10);
+
+    int* deq = (int*)spsc_dequeue(qu);
+    assert(deq && *deq == 10);
+    free(deq);
+
+    deq = (int*)spsc_try_dequeue(qu);
+    assert(deq && *deq == 20);
+    free(deq);
+
+    assert(spsc_try_dequeue(qu) == NULL);
+    assert(spsc_queue_front(qu) == NULL);
+
+    assert(free_spsc_queue(qu, free_int) == 0);
+}
+
+static void test_full_queue_and_wraparound() {
+    spsc_queue* qu = create_spsc_queue(3);
+    assert(qu != NULL && qu->mask == 3);
+
+    for (int round = 0; round < 3; ++round) {
+        for (int i = 0; i < 4; ++i) assert(spsc_try_enqueue(qu, TO_ELEMENT(i)) == 0);
+        assert(spsc_try_enqueue(qu, TO_ELEMENT(4)) == -1);
+
+        for (int i = 0; i < 4; ++i) assert(FROM_ELEMENT(spsc_try_dequeue(qu)) == i);
+        assert(spsc_try_dequeue(qu) == NULL);
+    }
+
+    assert(free_spsc_queue(qu, NULL) == 0);
+}
+
+static void test_batches() {
+    spsc_queue* qu = create_spsc_queue(8);
+    void* in[10];
+    void* out[10];
+
+    for (int i = 0; i < 10; ++i) in[i] = TO_ELEMENT(i);
+
+    // only as many elements as fit are taken
+    assert(spsc_enqueue_batch(qu, in, 10) == 8);
+    assert(spsc_enqueue_batch(qu, in, 10) == 0);
+
+    assert(spsc_dequeue_batch(qu, out, 3) == 3);
+    for (int i = 0; i < 3; ++i) assert(FROM_ELEMENT(out[i]) == i);
+
+    assert(spsc_enqueue_batch(qu, &in[8], 2) == 2);
+
+    assert(spsc_dequeue_batch(qu, out, 10) == 7);
+    for (int i = 0; i < 7; ++i) assert(FROM_ELEMENT(out[i]) == i + 3);
+    assert(spsc_dequeue_batch(qu, out, 10) == 0);
+
+    // a batch stops at the first NULL element
+    in[2] = NULL;
+    assert(spsc_enqueue_batch(qu, in, 5) == 2);
+
+    assert(free_spsc_queue(qu, NULL) == 0);
+}
+
+// ----------------- Edge cases -----------------
+
+static void test_null_and_invalid_inputs() {
+    void* out[1];
+    int* num = make_element_int(1);
+
+    assert(spsc_try_enqueue(NULL, num) == -1);
+    assert(spsc_enqueue(NULL, num) == -1);
+    assert(spsc_enqueue_batch(NULL, out, 1) == -1);
+    assert(spsc_try_dequeue(NULL) == NULL);
+    assert(spsc_dequeue(NULL) == NULL);
+    assert(spsc_dequeue_batch(NULL, out, 1) == -1);
+    assert(spsc_queue_front(NULL) == NULL);
+    assert(spsc_queue_size(NULL) == -1);
+    assert(free_spsc_queue(NULL, free_int) == -1);
+    // the slot array size would overflow
+    assert(create_spsc_queue(SSIZE_MAX) == NULL);
+
+    spsc_queue* qu = create_spsc_queue(0);
+    assert(qu != NULL && qu->mask == 1023);
+    assert(spsc_try_enqueue(qu, NULL) == -1);
+    assert(spsc_enqueue(qu, NULL) == -1);
+    assert(spsc_enqueue_batch(qu, NULL, 1) == -1);
+    assert(spsc_dequeue_batch(qu, out, -1) == -1);
+
+    // elements left in the queue are freed with it
+    assert(spsc_enqueue(qu, num) == 0);
+    assert(free_spsc_queue(qu, free_int) == 0);
+}
+
+// ----------------- Two-thread throughput test -----------------
+
+#define THROUGHPUT_N (1L << 21)
+#define THROUGHPUT_BATCH 64
+
+static void* producer_single(void* arg) {
+    spsc_queue* qu = arg;
+    for (long i = 0; i < THROUGHPUT_N; ++i) assert(spsc_enqueue(qu, TO_ELEMENT(i)) == 0);
+    return NULL;
+}
+
+static void* producer_batch(void* arg) {
+    spsc_queue* qu = arg;
+    void* batch[THROUGHPUT_BATCH];
+    long next = 0;
+
+    while (next < THROUGHPUT_N) {
+        ssize_t n = 0;
+        while (n < THROUGHPUT_BATCH && next + n < THROUGHPUT_N) {
+            batch[n] = TO_ELEMENT(next + n);
+            n++;
+        }
+        ssize_t sent = spsc_enqueue_batch(qu, batch, n);
+        assert(sent >= 0);
+        if (sent == 0) sched_yield();
+        next += sent;
+    }
+    return NULL;
+}
+
+static double elapsed_seconds(struct timespec start, struct timespec end) {
+    return (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+}
+
+static void run_throughput(const char* name, void* (*producer)(void*), int batched) {
+    spsc_queue* qu = create_spsc_queue(4096);
+    pthread_t thread;
+    struct timespec start, end;
+    void* out[THROUGHPUT_BATCH];
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    assert(pthread_create(&thread, NULL, producer, qu) == 0);
+
+    // the consumer runs on the main thread and checks FIFO order end to end
+    long expected = 0;
+    while (expected < THROUGHPUT_N) {
+        if (batched) {
+            ssize_t n = spsc_dequeue_batch(qu, out, THROUGHPUT_BATCH);
+            if (n == 0) sched_yield();
+            for (ssize_t i = 0; i < n; ++i, ++expected) assert(FROM_ELEMENT(out[i]) == expected);
+        } else {
+            void* val = spsc_dequeue(qu);
+            assert(FROM_ELEMENT(val) == expected);
+            expected++;
+        }
+    }
+
+    pthread_join(thread, NULL);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    assert(spsc_queue_size(qu) == 0);
+    double seconds = elapsed_seconds(start, end);
+    printf("spsc %s: %ld transfers in %.3fs (%.1f Mops/s)\n", name, THROUGHPUT_N, seconds, THROUGHPUT_N / seconds / 1e6);
+
+    free_spsc_queue(qu, NULL);
+}
+
+static void test_two_thread_throughput() {
+    run_throughput("single", producer_single, 0);
+    run_throughput("batch", producer_batch, 1);
+}
+
+int main(void) {
+    // Normal
+    test_enqueue_dequeue_front();
+    test_full_queue_and_wraparound();
+    test_batches();
+
+    // Edge
+    test_null_and_invalid_inputs();
+
+    // Threads
+    test_two_thread_throughput();
+
+    printf("✅ All spsc_queue tests passed!\n");
+    return 0;
+}
@@ -55,6 +55,68 @@ static void test_push_pop_peek() {
     free_stack(st, free_int);
 }
 
+static void test_push_pop_many() {
+    stack* st = create_stack(2);
+    void* batch[5];
+    void* out[5];
+    for (int i = 0; i < 5; ++i) batch[i] = make_element_int(i);
+
+    assert(stack_push_many(st, batch, 5) == 0);
+    assert(*(int*)stack_peek(st) == 4);
+
+    // former top first
+    assert(stack_pop_many(st, out, 3) == 3);
+    assert(*(int*)out[0] == 4 && *(int*)out[1] == 3 && *(int*)out[2] == 2);
+    for (int i = 0; i < 3; ++i) free(out[i]);
+
+    assert(stack_pop_many(st, out, 5) == 2);
+    assert(*(int*)out[0] == 1 && *(int*)out[1] == 0);
+    for (int i = 0; i < 2; ++i) free(out[i]);
+    assert(stack_pop_many(st, out, 5) == 0);
+
+    void* with_null[1] = {NULL};
+    assert(stack_push_many(st, with_null, 1) == -1);
+    assert(stack_push_many(NULL, batch, 1) == -1);
+    assert(stack_pop_many(NULL, out, 1) == -1);
+    assert(stack_pop_many(st, NULL, 1) == -1);
+
+    free_stack(st, free_int);
+}
+
+static void test_capacity_after_spike() {
+    stack* st = create_stack(16);
+    int value = 1;
+
+    assert(stack_set_auto_shrink(st, 1) == 0);
+    assert(stack_reserve(st, 4096) == 0 && st->arr->max_size == 4096);
+
+    // the reserved capacity is kept while draining
+    for (int i = 0; i < 3000; ++i) assert(stack_push(st, &value) == 0);
+    while (stack_pop(st) != NULL);
+    assert(st->arr->max_size == 4096);
+
+    // once shrunk to fit the floor drops, and a spike is given back as the stack drains
+    assert(stack_shrink_to_fit(st) == 0 && st->arr->max_size == 1);
+    for (int i = 0; i < 100000; ++i) assert(stack_push(st, &value) == 0);
+    assert(st->arr->max_size >= 100000);
+    void* out[1000];
+    while (st->arr->length > 1000) stack_pop_many(st, out, 1000);
+    while (stack_pop(st) != NULL);
+    assert(st->arr->max_size == 1);
+
+    // growth policy goes through to the list
+    assert(stack_set_growth(st, AL_GROW_CHUNK, 1000) == 0);
+    for (int i = 0; i < 10; ++i) stack_push(st, &value);
+    assert(st->arr->max_size == 1001);
+
+    assert(stack_reserve(NULL, 1) == -1);
+    assert(stack_shrink_to_fit(NULL) == -1);
+    assert(stack_set_growth(NULL, AL_GROW_DOUBLE, 0) == -1);
+    assert(stack_set_auto_shrink(NULL, 1) == -1);
+
+    free_stack(st, NULL);
+}
+
 // ----------------- Edge cases -----------------
 
 static void test_null_and_empty_stack() {
@@ -110,11 +172,56 @@ static void test_stress_operations() {
     free_stack(st, free_int);
 }
 
+// ----------------- Value stack -----------------
+
+static void test_value_stack() {
+    value_stack* st = create_value_stack(sizeof(double), 2);
+    assert(st != NULL);
+
+    for (int i = 0; i < 5; ++i) {
+        double v = i * 0.5;
+        assert(value_stack_push(st, &v) == 0);
+    }
+
+    double* top = (double*)value_stack_peek(st);
+    assert(top && *top == 2.0);
+
+    for (int i = 4; i >= 0; --i) {
+        double v;
+        assert(value_stack_pop(st, &v) == 0);
+        assert(v == i * 0.5);
+    }
+
+    // Empty and invalid inputs
+    double v = 1.0;
+    assert(value_stack_pop(st, &v) == -1);
+    assert(value_stack_peek(st) == NULL);
+    assert(value_stack_push(NULL, &v) == -1);
+    assert(value_stack_push(st, NULL) == -1);
+    assert(value_stack_pop(NULL, &v) == -1);
+    assert(value_stack_peek(NULL) == NULL);
+    assert(free_value_stack(NULL, NULL) == -1);
+    assert(create_value_stack(0, 5) == NULL);
+
+    // pushing the top onto itself, across reallocations
+    assert(value_stack_push(st, &v) == 0);
+    for (int i = 0; i < 20; ++i) assert(value_stack_push(st, value_stack_peek(st)) == 0);
+    for (int i = 0; i < 21; ++i) {
+        double out = 0;
+        assert(value_stack_pop(st, &out) == 0 && out == 1.0);
+    }
+
+    assert(free_value_stack(st, NULL) == 0);
+}
+
 int main(void) {
     test_push_pop_peek();
+    test_push_pop_many();
+    test_capacity_after_spike();
     test_null_and_empty_stack();
     test_free_element_null();
     test_stress_operations();
+    test_value_stack();
 
     printf("✅ All stack tests passed!\n");
     return 0;
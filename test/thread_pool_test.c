@@ -0,0 +1,152 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <sys/types.h>
+#include "../thread_pool.h"
+
+// ----------------- Helpers functions -----------------
+
+typedef struct {
+    atomic_int* hits;       // one counter per chunk
+    atomic_long total;
+} run_ctx;
+
+static void count_chunk(void* arg, ssize_t chunk) {
+    run_ctx* ctx = arg;
+    atomic_fetch_add(&ctx->hits[chunk], 1);
+    atomic_fetch_add(&ctx->total, (long)chunk);
+}
+
+static void run_and_check(thread_pool* pool, ssize_t chunks) {
+    run_ctx ctx;
+    ctx.hits = calloc((size_t)(chunks > 0 ? chunks : 1), sizeof(atomic_int));
+    atomic_init(&ctx.total, 0);
+
+    assert(thread_pool_run(pool, chunks, count_chunk, &ctx) == 0);
+
+    // every chunk ran exactly once
+    for (ssize_t i = 0; i < chunks; ++i) assert(atomic_load(&ctx.hits[i]) == 1);
+    assert(atomic_load(&ctx.total) == (long)chunks * (chunks - 1) / 2);
+
+    free(ctx.hits);
+}
+
+// ----------------- Normal usage tests -----------------
+
+static void test_create_and_run() {
+    thread_pool* pool = create_thread_pool(4);
+    assert(pool != NULL && pool->thread_count == 4 && pool->grain == 4096);
+
+    run_and_check(pool, 1);
+    run_and_check(pool, 4);
+    run_and_check(pool, 1000);
+    run_and_check(pool, 0);
+
+    free_thread_pool(pool);
+
+    // default thread count follows the CPUs
+    pool = create_thread_pool(0);
+    assert(pool != NULL && pool->thread_count >= 1);
+    run_and_check(pool, 64);
+    free_thread_pool(pool);
+}
+
+static void test_chunking() {
+    thread_pool* pool = create_thread_pool(4);
+
+    // small inputs stay serial
+    assert(thread_pool_chunks(pool, 0) == 1);
+    assert(thread_pool_chunks(pool, 4096) == 1);
+    assert(thread_pool_chunks(NULL, 1000000) == 1);
+
+    // no chunk smaller than the grain, at most a few per thread
+    assert(thread_pool_chunks(pool, 3 * 4096) == 3);
+    assert(thread_pool_chunks(pool, 1000000) == 16);
+
+    assert(thread_pool_set_grain(pool, 10) == 0);
+    assert(thread_pool_chunks(pool, 35) == 3);
+
+    free_thread_pool(pool);
+
+    // a single thread pool never splits
+    pool = create_thread_pool(1);
+    assert(thread_pool_chunks(pool, 1000000) == 1);
+    run_and_check(pool, 5);
+    free_thread_pool(pool);
+}
+
+static thread_pool* nesting_pool;
+
+static void nested_chunk(void* arg, ssize_t chunk) {
+    (void)arg;
+    (void)chunk;
+    // a job starting a job on its own pool runs it inline instead of deadlocking
+    run_and_check(nesting_pool, 8);
+}
+
+static void test_nested_run() {
+    nesting_pool = create_thread_pool(3);
+    assert(thread_pool_run(nesting_pool, 6, nested_chunk, NULL) == 0);
+
+    // the pool is still usable from the outside afterwards
+    run_and_check(nesting_pool, 9);
+
+    free_thread_pool(nesting_pool);
+}
+
+// ----------------- Edge cases -----------------
+
+static void test_null_and_invalid_inputs() {
+    thread_pool* pool = create_thread_pool(2);
+    run_ctx ctx;
+
+    assert(thread_pool_set_grain(NULL, 10) == -1);
+    assert(thread_pool_set_grain(pool, 0) == -1);
+    assert(thread_pool_run(pool, 4, NULL, &ctx) == -1);
+    assert(thread_pool_run(pool, -1, count_chunk, &ctx) == -1);
+
+    // without a pool the chunks run on the caller
+    run_and_check(NULL, 10);
+
+    free_thread_pool(pool);
+    free_thread_pool(NULL);
+}
+
+// ----------------- Stress test -----------------
+
+static thread_pool* shared_pool;
+
+static void* submit_jobs(void* arg) {
+    (void)arg;
+    for (int i = 0; i < 200; ++i) run_and_check(shared_pool, 1 + i % 37);
+    return NULL;
+}
+
+static void test_stress_operations() {
+    shared_pool = create_thread_pool(4);
+
+    // jobs posted from several threads take turns
+    pthread_t callers[4];
+    for (int i = 0; i < 4; ++i) pthread_create(&callers[i], NULL, submit_jobs, NULL);
+    for (int i = 0; i < 4; ++i) pthread_join(callers[i], NULL);
+
+    free_thread_pool(shared_pool);
+}
+
+int main(void) {
+    // Normal
+    test_create_and_run();
+    test_chunking();
+    test_nested_run();
+
+    // Edge
+    test_null_and_invalid_inputs();
+
+    // Stress
+    test_stress_operations();
+
+    printf("✅ All thread_pool tests passed!\n");
+    return 0;
+}
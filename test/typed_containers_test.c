@@ -0,0 +1,225 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <assert.h>
+#include <sys/types.h>
+#include "../typed_array_list.h"
+#include "../typed_stack.h"
+#include "../typed_queue.h"
+#include "../typed_linked_list.h"
+
+// ----------------- Instantiations -----------------
+
+typedef struct {
+    int x;
+    int y;
+} point;
+
+#define POINT_COMPARE(a, b) ((a).x == (b).x && (a).y == (b).y ? 0 : -1)
+
+static int freed_strings = 0;
+
+static void free_string(char* s) {
+    free(s);
+    freed_strings++;
+}
+
+static int compare_string(char* a, char* b) {
+    return strcmp(a, b) == 0 ? 0 : -1;
+}
+
+static int compare_ptr(void* a, void* b) {
+    return (a == b) ? 0 : -1;
+}
+
+DEFINE_TYPED_ARRAY_LIST(int_list, int, TYPED_EQ_COMPARE, TYPED_NO_FREE)
+DEFINE_TYPED_ARRAY_LIST(point_list, point, POINT_COMPARE, TYPED_NO_FREE)
+DEFINE_TYPED_ARRAY_LIST(string_list, char*, compare_string, free_string)
+// the generic array_list is the void* instantiation
+DEFINE_TYPED_ARRAY_LIST(ptr_list, void*, compare_ptr, TYPED_NO_FREE)
+DEFINE_TYPED_STACK(double_stack, double, TYPED_NO_FREE)
+DEFINE_TYPED_QUEUE(int_queue, int, TYPED_NO_FREE)
+DEFINE_TYPED_LINKED_LIST(int_llist, int, TYPED_EQ_COMPARE, TYPED_NO_FREE)
+DEFINE_TYPED_LINKED_LIST(string_llist, char*, compare_string, free_string)
+
+static char* make_string(const char* s) {
+    char* p = malloc(strlen(s) + 1);
+    assert(p != NULL);
+    strcpy(p, s);
+    return p;
+}
+
+// ----------------- Array list -----------------
+
+static void test_int_list() {
+    int_list* list = int_list_create(2);
+    assert(list != NULL && list->max_size == 2);
+
+    for (int i = 0; i < 10; ++i) assert(int_list_append(list, i * 10) == 0);
+    assert(list->length == 10 && list->max_size == 16);
+
+    // [0,10,...,90] → insert 5 at index 1
+    assert(int_list_add(list, 1, 5) == 0);
+    int v;
+    assert(int_list_get(list, 1, &v) == 0 && v == 5);
+    assert(*int_list_at(list, 2) == 10);
+
+    assert(int_list_get_index(list, 40) == 5);
+    assert(int_list_get_index(list, 41) == -1);
+
+    assert(int_list_set(list, 0, -1) == 0);
+    assert(int_list_delete(list, 1, &v) == 0 && v == 5);
+    assert(int_list_pop(list, &v) == 0 && v == 90);
+
+    int_list_reverse(list);
+    assert(list->arr[0] == 80 && list->arr[list->length - 1] == -1);
+
+    // invalid inputs
+    assert(int_list_get(list, list->length, &v) == -1);
+    assert(int_list_add(list, list->length + 1, 1) == -1);
+    assert(int_list_delete(list, -1, NULL) == -1);
+    assert(int_list_append(NULL, 1) == -1);
+    assert(int_list_at(NULL, 0) == NULL);
+
+    int_list_free(list);
+}
+
+static void test_struct_and_owned_lists() {
+    point_list* points = point_list_create(0);
+    for (int i = 0; i < 5; ++i) point_list_append(points, (point){i, -i});
+
+    assert(point_list_get_index(points, (point){3, -3}) == 3);
+    assert(point_list_get_index(points, (point){3, 3}) == -1);
+    point_list_free(points);
+
+    // the list owns its strings: set, delete without out and free release them
+    freed_strings = 0;
+    string_list* strings = string_list_create(0);
+    string_list_append(strings, make_string("a"));
+    string_list_append(strings, make_string("b"));
+    string_list_append(strings, make_string("c"));
+
+    assert(string_list_get_index(strings, "b") == 1);
+    assert(string_list_set(strings, 1, make_string("B")) == 0);
+    assert(freed_strings == 1);
+    assert(string_list_delete(strings, 0, NULL) == 0);
+    assert(freed_strings == 2);
+
+    // with an out pointer ownership moves to the caller
+    char* taken;
+    assert(string_list_pop(strings, &taken) == 0 && strcmp(taken, "c") == 0);
+    free(taken);
+
+    string_list_free(strings);
+    assert(freed_strings == 3);
+}
+
+static void test_void_ptr_instantiation() {
+    int a = 1, b = 2;
+    ptr_list* list = ptr_list_create(10);
+
+    ptr_list_append(list, &a);
+    ptr_list_append(list, &b);
+    assert(ptr_list_get_index(list, &b) == 1);
+    assert(*(int*)list->arr[0] == 1);
+
+    ptr_list_free(list);
+}
+
+// ----------------- Stack and queue -----------------
+
+static void test_double_stack() {
+    double_stack* st = double_stack_create(1);
+    assert(st != NULL);
+
+    for (int i = 0; i < 5; ++i) assert(double_stack_push(st, i * 1.5) == 0);
+    assert(*double_stack_peek(st) == 6.0);
+
+    double v;
+    for (int i = 4; i >= 0; --i) {
+        assert(double_stack_pop(st, &v) == 0);
+        assert(v == i * 1.5);
+    }
+    assert(double_stack_pop(st, &v) == -1);
+    assert(double_stack_peek(st) == NULL);
+    assert(double_stack_push(NULL, 1.0) == -1);
+
+    assert(double_stack_free(st) == 0);
+    assert(double_stack_free(NULL) == -1);
+}
+
+static void test_int_queue() {
+    int_queue* qu = int_queue_create(4);
+    assert(qu != NULL && qu->capacity == 4);
+
+    int next_out = 0, v;
+    for (int i = 0; i < 50; ++i) {
+        assert(int_queue_enqueue(qu, i) == 0);
+        if (i % 3 == 0) {
+            assert(int_queue_dequeue(qu, &v) == 0 && v == next_out++);
+        }
+    }
+    assert(*int_queue_front(qu) == next_out);
+    while (int_queue_dequeue(qu, &v) == 0) assert(v == next_out++);
+    assert(next_out == 50);
+    assert(int_queue_front(qu) == NULL);
+    assert(int_queue_enqueue(NULL, 1) == -1);
+
+    // the ring size would overflow
+    assert(int_queue_create(SSIZE_MAX) == NULL);
+    assert(int_queue_create(SSIZE_MAX / 2 + 1) == NULL);
+
+    assert(int_queue_free(qu) == 0);
+}
+
+// ----------------- Linked list -----------------
+
+static void test_int_llist() {
+    int_llist* list = int_llist_create();
+    assert(list != NULL);
+
+    for (int i = 1; i <= 3; ++i) assert(int_llist_append(list, i) == 0);
+    assert(int_llist_add(list, 0, 0) == 0);
+    assert(int_llist_add(list, 2, 42) == 0);   // [0,1,42,2,3]
+
+    int v;
+    assert(int_llist_get(list, 2, &v) == 0 && v == 42);
+    assert(int_llist_get_index(list, 3) == 4);
+
+    assert(int_llist_delete(list, 2, &v) == 0 && v == 42);
+    assert(int_llist_set(list, 0, -5) == 0);
+    assert(int_llist_pop(list, &v) == 0 && v == 3);
+
+    int_llist_reverse(list);  // [2,1,-5]
+    assert(int_llist_get(list, 0, &v) == 0 && v == 2);
+    assert(int_llist_get(list, 2, &v) == 0 && v == -5);
+    assert(list->head->prev == NULL && list->tail->next == NULL);
+
+    assert(int_llist_get(list, 3, &v) == -1);
+    assert(int_llist_add(list, 5, 1) == -1);
+    assert(int_llist_pop(NULL, &v) == -1);
+
+    while (list->length > 0) assert(int_llist_pop(list, NULL) == 0);
+    assert(list->head == NULL && list->tail == NULL);
+    assert(int_llist_free(list) == 0);
+
+    freed_strings = 0;
+    string_llist* strings = string_llist_create();
+    string_llist_append(strings, make_string("x"));
+    string_llist_append(strings, make_string("y"));
+    assert(string_llist_get_index(strings, "y") == 1);
+    assert(string_llist_free(strings) == 0);
+    assert(freed_strings == 2);
+}
+
+int main(void) {
+    test_int_list();
+    test_struct_and_owned_lists();
+    test_void_ptr_instantiation();
+    test_double_stack();
+    test_int_queue();
+    test_int_llist();
+
+    printf("✅ All typed_containers tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,256 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <sys/types.h>
+#include "../unrolled_list.h"
+
+// ----------------- Helper functions -----------------
+
+static int *make_element_int(int v) {
+    int *p = malloc(sizeof(int));
+    assert(p != NULL);
+    *p = v;
+    return p;
+}
+
+static void free_int(void *p) {
+    free(p);
+}
+
+static int compare_int(void *a, void *b) {
+    if (a == NULL || b == NULL) return -1;
+    return (*(int*)a == *(int*)b) ? 0 : -1;
+}
+
+static void print_int(void *p) {
+    if (p == NULL) return;
+    printf("[%d]", *(int*)p);
+}
+
+// checks the node chain against the list length and that no node is empty
+static void check_invariants(const unrolled_list *list) {
+    ssize_t total = 0;
+    unrolled_node *prev = NULL;
+    for (unrolled_node *n = list->head; n != NULL; n = n->next) {
+        assert(n->prev == prev);
+        assert(n->count > 0 && n->count <= UNROLLED_NODE_CAPACITY);
+        total += n->count;
+        prev = n;
+    }
+    assert(list->tail == prev);
+    assert(total == list->length);
+}
+
+// ----------------- Tests -----------------
+
+static void test_create_and_append() {
+    unrolled_list *list = create_unrolled_list();
+    assert(list != NULL);
+    assert(list->length == 0 && list->head == NULL && list->tail == NULL);
+
+    assert(ulappend(list, make_element_int(10)) == 0);
+    assert(ulappend(list, make_element_int(20)) == 0);
+    assert(list->length == 2);
+    assert(list->head == list->tail);
+
+    int *a = (int *)ulget(list, 0);
+    int *b = (int *)ulget(list, 1);
+    assert(a != NULL && b != NULL);
+    assert(*a == 10 && *b == 20);
+
+    free_unrolled_list(list, free_int);
+}
+
+static void test_add_set_get() {
+    unrolled_list *list = create_unrolled_list();
+
+    assert(ulappend(list, make_element_int(1)) == 0);
+    assert(ulappend(list, make_element_int(3)) == 0);
+
+    // Insert 2 at index 1 → [1,2,3]
+    assert(uladd(list, 1, make_element_int(2)) == 0);
+    assert(list->length == 3);
+    int *val = (int *)ulget(list, 1);
+    assert(val != NULL && *val == 2);
+
+    assert(ulset(list, 1, make_element_int(42), free_int) == 0);
+    val = (int *)ulget(list, 1);
+    assert(val != NULL && *val == 42);
+
+    free_unrolled_list(list, free_int);
+}
+
+static void test_index_delete() {
+    unrolled_list *list = create_unrolled_list();
+
+    assert(ulappend(list, make_element_int(5)) == 0);
+    assert(ulappend(list, make_element_int(10)) == 0);
+    assert(ulappend(list, make_element_int(15)) == 0);
+
+    int target = 10;
+    assert(ulget_index(list, &target, compare_int) == 1);
+
+    // Delete index 1 → [5,15]
+    assert(uldelete(list, 1, free_int) == 0);
+    assert(list->length == 2);
+    int *val = (int *)ulget(list, 1);
+    assert(val != NULL && *val == 15);
+
+    free_unrolled_list(list, free_int);
+}
+
+static void test_pop_reverse() {
+    unrolled_list *list = create_unrolled_list();
+    const int N = 3 * UNROLLED_NODE_CAPACITY + 5;
+
+    for (int i = 0; i < N; ++i) assert(ulappend(list, make_element_int(i)) == 0);
+
+    // Reverse across several nodes
+    ulreverse(list);
+    check_invariants(list);
+    for (int i = 0; i < N; ++i) {
+        int *v = (int *)ulget(list, i);
+        assert(v != NULL && *v == N - 1 - i);
+    }
+
+    // Pop last → removes 0
+    assert(ulpop(list, free_int) == 0);
+    assert(list->length == N - 1);
+    int *last = (int *)ulget(list, list->length - 1);
+    assert(last != NULL && *last == 1);
+
+    free_unrolled_list(list, free_int);
+}
+
+static void test_split_and_merge() {
+    unrolled_list *list = create_unrolled_list();
+
+    // fill exactly one node, then insert in the middle to force a split
+    for (int i = 0; i < UNROLLED_NODE_CAPACITY; ++i) assert(ulappend(list, make_element_int(i)) == 0);
+    assert(list->head == list->tail);
+
+    assert(uladd(list, 3, make_element_int(-1)) == 0);
+    assert(list->head != list->tail);
+    check_invariants(list);
+    int *v = (int *)ulget(list, 3);
+    assert(v && *v == -1);
+    v = (int *)ulget(list, 4);
+    assert(v && *v == 3);
+
+    // deleting from the first node eventually folds the second one back in
+    while (list->head != list->tail) {
+        assert(uldelete(list, 0, free_int) == 0);
+        check_invariants(list);
+    }
+    v = (int *)ulget(list, list->length - 1);
+    assert(v && *v == UNROLLED_NODE_CAPACITY - 1);
+
+    free_unrolled_list(list, free_int);
+}
+
+// ----------------- Edge Case Tests -----------------
+
+static void test_null_and_invalid_inputs() {
+    unrolled_list *list = create_unrolled_list();
+    int *p = make_element_int(2);
+    int *q = make_element_int(5);
+
+    assert(ulappend(NULL, p) == -1);
+    assert(uladd(NULL, 0, p) == -1);
+    assert(ulset(NULL, 0, q, free_int) == -1);
+    assert(ulget_index(NULL, p, compare_int) == -1);
+    assert(ulget_index(list, p, NULL) == -1);
+    assert(ulget(NULL, 0) == NULL);
+    assert(uldelete(NULL, 0, free_int) == -1);
+    assert(ulpop(NULL, free_int) == -1);
+    assert(free_unrolled_list(NULL, free_int) == -1);
+    ulreverse(NULL);
+    ulprint(NULL, print_int);
+
+    assert(ulappend(list, NULL) == -1);
+    assert(ulappend(list, q) == 0);
+    assert(ulget(list, -1) == NULL);
+    assert(ulget(list, 1) == NULL);
+    assert(uladd(list, 2, q) == -1);
+    assert(uldelete(list, 1, free_int) == -1);
+    assert(ulset(list, 1, p, free_int) == -1);
+
+    free(p);
+    free_unrolled_list(list, free_int);
+}
+
+static void test_empty_list_operations() {
+    unrolled_list *list = create_unrolled_list();
+
+    assert(ulpop(list, free_int) == -1);
+    assert(uldelete(list, 0, free_int) == -1);
+    ulreverse(list);
+    ulprint(list, print_int);
+
+    // emptying a list releases its last node
+    assert(ulappend(list, make_element_int(1)) == 0);
+    assert(ulpop(list, free_int) == 0);
+    assert(list->head == NULL && list->tail == NULL && list->length == 0);
+
+    free_unrolled_list(list, free_int);
+}
+
+// ----------------- Stress test -----------------
+
+// random edits mirrored on a plain array
+static void test_stress_against_array() {
+    unrolled_list *list = create_unrolled_list();
+    enum { MAX = 2000 };
+    static int reference[MAX];
+    ssize_t length = 0;
+    srand(42);
+
+    for (int step = 0; step < 20000; ++step) {
+        int op = rand() % 4;
+        if ((op <= 1 || length == 0) && length < MAX) {
+            ssize_t idx = rand() % (length + 1);
+            int v = rand();
+            assert(uladd(list, idx, make_element_int(v)) == 0);
+            for (ssize_t i = length; i > idx; --i) reference[i] = reference[i - 1];
+            reference[idx] = v;
+            length++;
+        } else if (op == 2 && length > 0) {
+            ssize_t idx = rand() % length;
+            assert(uldelete(list, idx, free_int) == 0);
+            for (ssize_t i = idx; i < length - 1; ++i) reference[i] = reference[i + 1];
+            length--;
+        } else if (length > 0) {
+            ssize_t idx = rand() % length;
+            int *v = (int *)ulget(list, idx);
+            assert(v && *v == reference[idx]);
+        }
+    }
+
+    check_invariants(list);
+    assert(list->length == length);
+    for (ssize_t i = 0; i < length; ++i) {
+        int *v = (int *)ulget(list, i);
+        assert(v && *v == reference[i]);
+    }
+
+    free_unrolled_list(list, free_int);
+}
+
+int main(void) {
+    // Normal operations
+    test_create_and_append();
+    test_add_set_get();
+    test_index_delete();
+    test_pop_reverse();
+    test_split_and_merge();
+
+    // Edge cases
+    test_null_and_invalid_inputs();
+    test_empty_list_operations();
+
+    // Stress
+    test_stress_against_array();
+
+    printf("✅ All unrolled_list tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,295 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <assert.h>
+#include <stdint.h>
+#include <sys/types.h>
+#include "../value_list.h"
+
+// ----------------- Helpers functions -----------------
+
+typedef struct {
+    int id;
+    double weight;
+} record;
+
+static int compare_record_id(void* a, void* b) {
+    if (!a || !b) return -1;
+    return (((record*)a)->id == ((record*)b)->id) ? 0 : -1;
+}
+
+static void print_int(void* p) {
+    if (p) printf("[%d]", *(int*)p);
+}
+
+static int owned_freed = 0;
+
+// stored values hold a pointer the list is responsible for
+static void free_owned(void* slot) {
+    free(*(int**)slot);
+    owned_freed++;
+}
+
+// ----------------- Normal usage tests -----------------
+
+static void test_create_and_append() {
+    value_list* list = create_value_list(sizeof(int), 10);
+    assert(list != NULL);
+    assert(list->length == 0 && list->element_size == sizeof(int));
+
+    int a = 10, b = 20;
+    assert(vlappend(list, &a) == 0);
+    assert(vlappend(list, &b) == 0);
+    assert(list->length == 2);
+
+    // values are copied in, changing the originals does not touch the list
+    a = 0;
+    int out;
+    assert(vlget(list, 0, &out) == 0 && out == 10);
+    assert(*(int*)vlat(list, 1) == 20);
+
+    // elements are stored contiguously
+    assert((int*)vlat(list, 1) == (int*)vlat(list, 0) + 1);
+
+    free_value_list(list, NULL);
+}
+
+static void test_add_set_get_structs() {
+    value_list* list = create_value_list(sizeof(record), 2);
+    record r1 = {1, 1.5}, r3 = {3, 3.5}, r2 = {2, 2.5};
+
+    vlappend(list, &r1);
+    vlappend(list, &r3);
+
+    // Insert r2 at index 1 → [r1,r2,r3], growing past the initial capacity
+    assert(vladd(list, 1, &r2) == 0);
+    assert(list->length == 3 && list->max_size == 4);
+    record out;
+    assert(vlget(list, 1, &out) == 0 && out.id == 2 && out.weight == 2.5);
+
+    record r42 = {42, 0.0};
+    assert(vlset(list, 1, &r42) == 0);
+    assert(((record*)vlat(list, 1))->id == 42);
+
+    record key = {3, 0.0};
+    assert(vlget_index(list, &key, compare_record_id) == 2);
+
+    free_value_list(list, NULL);
+}
+
+static void test_index_delete() {
+    value_list* list = create_value_list(sizeof(int), 10);
+    for (int v = 5; v <= 15; v += 5) vlappend(list, &v);
+
+    // byte-wise comparison when no compare function is given
+    int target = 10;
+    assert(vlget_index(list, &target, NULL) == 1);
+
+    // Delete index 1 → [5,15]
+    int removed;
+    assert(vldelete(list, 1, &removed) == 0 && removed == 10);
+    assert(list->length == 2);
+    assert(*(int*)vlat(list, 1) == 15);
+    assert(vldelete(list, 0, NULL) == 0);
+
+    free_value_list(list, NULL);
+}
+
+static void test_pop_reverse() {
+    value_list* list = create_value_list(sizeof(int), 10);
+    for (int v = 1; v <= 3; ++v) vlappend(list, &v);
+
+    // Reverse → [3,2,1]
+    vlreverse(list);
+    assert(*(int*)vlat(list, 0) == 3 && *(int*)vlat(list, 1) == 2 && *(int*)vlat(list, 2) == 1);
+
+    // Pop last → removes 1
+    int popped;
+    assert(vlpop(list, &popped) == 0 && popped == 1);
+    assert(list->length == 2);
+    assert(vlpop(list, NULL) == 0);
+
+    free_value_list(list, NULL);
+}
+
+static void test_large_elements_reverse() {
+    typedef struct { char bytes[300]; } big;
+    value_list* list = create_value_list(sizeof(big), 4);
+    big x;
+
+    for (int i = 0; i < 5; ++i) {
+        for (int j = 0; j < 300; ++j) x.bytes[j] = (char)(i + j);
+        vlappend(list, &x);
+    }
+
+    // elements larger than the swap buffer are swapped in chunks
+    vlreverse(list);
+    for (int i = 0; i < 5; ++i) {
+        big* e = vlat(list, i);
+        for (int j = 0; j < 300; ++j) assert(e->bytes[j] == (char)(4 - i + j));
+    }
+
+    free_value_list(list, NULL);
+}
+
+static void test_find_integer_keys() {
+    // every length around the vector widths, with the key at every position
+    for (ssize_t n = 0; n <= 40; ++n) {
+        value_list* list32 = create_value_list(sizeof(int32_t), 0);
+        value_list* list64 = create_value_list(sizeof(int64_t), 0);
+        for (ssize_t i = 0; i < n; ++i) {
+            int32_t v32 = (int32_t)(i * 3 - 20);
+            int64_t v64 = ((int64_t)1 << 40) + i * 3;
+            vlappend(list32, &v32);
+            vlappend(list64, &v64);
+        }
+
+        for (ssize_t i = 0; i < n; ++i) {
+            assert(vlfind_int32(list32, (int32_t)(i * 3 - 20)) == i);
+            assert(vlfind_int64(list64, ((int64_t)1 << 40) + i * 3) == i);
+        }
+        assert(vlfind_int32(list32, 2) == -1);
+        // same low 32 bits as a stored key but a different high half
+        assert(vlfind_int64(list64, ((int64_t)2 << 40) + 3) == -1);
+
+        free_value_list(list32, NULL);
+        free_value_list(list64, NULL);
+    }
+
+    // duplicates return the first one, negative keys work
+    value_list* list = create_value_list(sizeof(int32_t), 0);
+    int32_t values[] = {5, -1, 9, -1, 9};
+    for (int i = 0; i < 5; ++i) vlappend(list, &values[i]);
+    assert(vlfind_int32(list, -1) == 1);
+    assert(vlfind_int32(list, 9) == 2);
+
+    // the element size has to match the key width
+    assert(vlfind_int64(list, 5) == -1);
+    assert(vlfind_int32(NULL, 5) == -1);
+    free_value_list(list, NULL);
+}
+
+// ----------------- Edge cases -----------------
+
+static void test_null_and_invalid_inputs() {
+    int v = 1, out;
+
+    assert(create_value_list(0, 10) == NULL);
+    assert(create_value_list(-4, 10) == NULL);
+
+    value_list* list = create_value_list(sizeof(int), 0);
+    assert(list != NULL && list->max_size == 10);
+
+    assert(vlappend(NULL, &v) == -1);
+    assert(vlappend(list, NULL) == -1);
+    assert(vladd(NULL, 0, &v) == -1);
+    assert(vlset(NULL, 0, &v) == -1);
+    assert(vlget(NULL, 0, &out) == -1);
+    assert(vlat(NULL, 0) == NULL);
+    assert(vldelete(NULL, 0, NULL) == -1);
+    assert(vlpop(NULL, NULL) == -1);
+    assert(vlget_index(NULL, &v, NULL) == -1);
+    vlreverse(NULL);
+    vlprint(NULL, print_int);
+    free_value_list(NULL, NULL);
+
+    // Empty list
+    assert(vlpop(list, &out) == -1);
+    assert(vldelete(list, 0, &out) == -1);
+    vlreverse(list);
+    vlprint(list, print_int);
+
+    // Invalid indices
+    vlappend(list, &v);
+    assert(vlat(list, -1) == NULL);
+    assert(vlat(list, 1) == NULL);
+    assert(vlget(list, 0, NULL) == -1);
+    assert(vladd(list, 2, &v) == -1);
+    assert(vldelete(list, 1, NULL) == -1);
+    assert(vlset(list, 1, &v) == -1);
+
+    free_value_list(list, NULL);
+}
+
+static void test_free_element_callback() {
+    value_list* list = create_value_list(sizeof(int*), 2);
+    owned_freed = 0;
+
+    for (int i = 0; i < 3; ++i) {
+        int* p = malloc(sizeof(int));
+        *p = i;
+        vlappend(list, &p);
+    }
+
+    free_value_list(list, free_owned);
+    assert(owned_freed == 3);
+}
+
+// values read straight out of the list (vlat) while the list grows and shifts
+static void test_self_insert() {
+    value_list* list = create_value_list(sizeof(int), 2);
+    int a = 1, b = 2;
+    vlappend(list, &a);
+    vlappend(list, &b);
+
+    // full, so both calls reallocate while element points into the old array
+    assert(vlappend(list, vlat(list, 0)) == 0);
+    assert(list->length == 3 && *(int*)vlat(list, 2) == 1);
+
+    while (list->length < list->max_size) assert(vlappend(list, &b) == 0);
+    assert(vladd(list, 0, vlat(list, 1)) == 0);
+    assert(*(int*)vlat(list, 0) == 2 && *(int*)vlat(list, 1) == 1 && *(int*)vlat(list, 2) == 2);
+
+    // no realloc, the shift moves the source past the insertion point: [2,1,2,1,...] -> [2,1,1,2,1,...]
+    assert(list->length < list->max_size);
+    assert(vladd(list, 2, vlat(list, 3)) == 0);
+    assert(*(int*)vlat(list, 2) == 1 && *(int*)vlat(list, 3) == 2 && *(int*)vlat(list, 4) == 1);
+
+    // a source before the insertion point doesn't move
+    assert(vladd(list, 3, vlat(list, 0)) == 0);
+    assert(*(int*)vlat(list, 3) == 2 && *(int*)vlat(list, 4) == 2);
+
+    free_value_list(list, NULL);
+}
+
+// ----------------- Stress test -----------------
+
+static void test_stress_operations() {
+    value_list* list = create_value_list(sizeof(long), 1);
+    const long N = 10000;
+
+    for (long i = 0; i < N; ++i) assert(vlappend(list, &i) == 0);
+    assert(list->length == N);
+
+    vlreverse(list);
+    assert(*(long*)vlat(list, 0) == N - 1 && *(long*)vlat(list, N - 1) == 0);
+
+    for (int i = 0; i < 10; ++i) assert(vldelete(list, 10, NULL) == 0);
+    for (long i = 0; i < 5; ++i) {
+        long v = i * 1000;
+        assert(vlset(list, i, &v) == 0);
+    }
+    assert(*(long*)vlat(list, 10) == N - 21);
+
+    free_value_list(list, NULL);
+}
+
+int main(void) {
+    // Normal
+    test_create_and_append();
+    test_add_set_get_structs();
+    test_index_delete();
+    test_pop_reverse();
+    test_large_elements_reverse();
+    test_find_integer_keys();
+
+    // Edge
+    test_null_and_invalid_inputs();
+    test_free_element_callback();
+    test_self_insert();
+
+    // Stress
+    test_stress_operations();
+
+    printf("✅ All value_list tests passed!\n");
+    return 0;
+}
@@ -0,0 +1,168 @@
+#include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include "thread_pool.h"
+
+#define DEFAULT_GRAIN 4096
+// chunks per thread, so a thread that got slow chunks doesn't hold the others back
+#define CHUNKS_PER_THREAD 4
+
+// pool whose job the current thread is working on, so a nested run on it goes inline instead of deadlocking
+static _Thread_local thread_pool* current_pool = NULL;
+
+// run chunks of the current job until none are left, called with the lock held
+static void work_on_job(thread_pool* pool){
+    while (pool->next_chunk < pool->chunks){
+        ssize_t chunk = pool->next_chunk++;
+        void (*job) (void*, ssize_t) = pool->job;
+        void* ctx = pool->job_ctx;
+
+        pthread_mutex_unlock(&pool->lock);
+        job(ctx, chunk);
+        pthread_mutex_lock(&pool->lock);
+
+        pool->finished++;
+        if (pool->finished == pool->chunks) pthread_cond_signal(&pool->done);
+    }
+}
+
+static void* worker_main(void* arg){
+    thread_pool* pool = arg;
+    unsigned long seen = 0;
+
+    current_pool = pool;
+    pthread_mutex_lock(&pool->lock);
+
+    for (;;){
+        while (!pool->stop && pool->generation == seen)
+            pthread_cond_wait(&pool->wake, &pool->lock);
+
+        if (pool->stop) break;
+
+        seen = pool->generation;
+        work_on_job(pool);
+    }
+
+    pthread_mutex_unlock(&pool->lock);
+
+    return NULL;
+}
+
+thread_pool* create_thread_pool(ssize_t thread_count){
+    if (thread_count <= 0){
+        long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+        thread_count = (cpus > 0 ? cpus : 1);
+    }
+
+    thread_pool* pool = malloc(sizeof(thread_pool));
+
+    if (pool == NULL) return NULL;
+
+    pool->workers = malloc(sizeof(pthread_t) * (size_t)(thread_count > 1 ? thread_count - 1 : 1));
+
+    if (pool->workers == NULL){
+        free(pool);
+        return NULL;
+    }
+
+    pool->thread_count = 1;
+    pool->grain = DEFAULT_GRAIN;
+    pool->job = NULL;
+    pool->job_ctx = NULL;
+    pool->chunks = 0;
+    pool->next_chunk = 0;
+    pool->finished = 0;
+    pool->generation = 0;
+    pool->stop = 0;
+
+    pthread_mutex_init(&pool->run_lock, NULL);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->done, NULL);
+
+    // thread_count only counts the workers that actually started
+    for (ssize_t i = 0; i < thread_count - 1; i++){
+        if (pthread_create(&pool->workers[i], NULL, worker_main, pool) != 0){
+            free_thread_pool(pool);
+            return NULL;
+        }
+        pool->thread_count++;
+    }
+
+    return pool;
+}
+
+int thread_pool_set_grain(thread_pool *pool, ssize_t grain){
+    if (pool == NULL || grain <= 0) return -1;
+
+    pool->grain = grain;
+
+    return 0;
+}
+
+ssize_t thread_pool_chunks(const thread_pool *pool, ssize_t count){
+    if (pool == NULL || pool->thread_count <= 1 || count <= pool->grain) return 1;
+
+    ssize_t by_grain = count / pool->grain;
+    ssize_t by_threads = pool->thread_count * CHUNKS_PER_THREAD;
+
+    return (by_grain < by_threads ? by_grain : by_threads);
+}
+
+int thread_pool_run(thread_pool *pool, ssize_t chunks, void (*job) (void* ctx, ssize_t chunk), void* ctx){
+    if (job == NULL || chunks < 0) return -1;
+
+    // a job running on this pool can't wait for the pool, its own chunk holds it busy
+    if (pool == NULL || pool->thread_count <= 1 || chunks <= 1 || current_pool == pool){
+        for (ssize_t i = 0; i < chunks; i++) job(ctx, i);
+        return 0;
+    }
+
+    pthread_mutex_lock(&pool->run_lock);
+    pthread_mutex_lock(&pool->lock);
+
+    pool->job = job;
+    pool->job_ctx = ctx;
+    pool->chunks = chunks;
+    pool->next_chunk = 0;
+    pool->finished = 0;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+
+    // the caller takes chunks like any worker, then waits for the stragglers
+    thread_pool* outer_pool = current_pool;
+    current_pool = pool;
+    work_on_job(pool);
+    current_pool = outer_pool;
+    while (pool->finished < pool->chunks)
+        pthread_cond_wait(&pool->done, &pool->lock);
+
+    pool->job = NULL;
+    pool->job_ctx = NULL;
+
+    pthread_mutex_unlock(&pool->lock);
+    pthread_mutex_unlock(&pool->run_lock);
+
+    return 0;
+}
+
+void free_thread_pool(thread_pool *pool){
+    if (pool == NULL) return;
+
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (ssize_t i = 0; i < pool->thread_count - 1; i++)
+        pthread_join(pool->workers[i], NULL);
+
+    pthread_mutex_destroy(&pool->run_lock);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_cond_destroy(&pool->wake);
+    pthread_cond_destroy(&pool->done);
+
+    free(pool->workers);
+    free(pool);
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <pthread.h>
+#include <sys/types.h>
+
+/**
+ * @brief Fixed set of worker threads running chunked jobs, used by the parallel array_list functions.
+ * @note the thread calling thread_pool_run works on the job too, so a pool of n threads starts n - 1 workers. one job runs at a time, concurrent callers take turns.
+ * @note a job may run another job on the same pool (e.g. alsort_parallel from an alparallel_for callback): the nested job runs serially on the thread that started it. jobs of two pools starting jobs on each other can still deadlock.
+ */
+typedef struct thread_pool {
+    pthread_t* workers;          /**< Worker threads */
+    ssize_t thread_count;        /**< Threads working on a job, the caller included */
+    ssize_t grain;               /**< Minimum number of elements per chunk, smaller inputs run on the caller only */
+
+    pthread_mutex_t run_lock;    /**< Held for the whole run of a job */
+    pthread_mutex_t lock;        /**< Protects the job fields below */
+    pthread_cond_t wake;         /**< Signals the workers that a job (or stop) is posted */
+    pthread_cond_t done;         /**< Signals the caller that the last chunk finished */
+
+    void (*job) (void* ctx, ssize_t chunk); /**< Job being run */
+    void* job_ctx;               /**< Context passed to the job */
+    ssize_t chunks;              /**< Number of chunks of the job */
+    ssize_t next_chunk;          /**< Next chunk to hand out */
+    ssize_t finished;            /**< Number of chunks completed */
+    unsigned long generation;    /**< Incremented for every job, so workers can tell a new one was posted */
+    int stop;                    /**< Set when the pool is freed */
+} thread_pool;
+
+/**
+ * @brief Create a new thread pool.
+ * @param thread_count Number of threads working on a job, the caller included.
+ * @note if the thread_count <= 0 it defaults to the number of online CPUs. the grain defaults to 4096 elements.
+ * @return Pointer to the newly created pool, or NULL on failure.
+ */
+thread_pool* create_thread_pool(ssize_t thread_count);
+
+/**
+ * @brief Set the minimum number of elements handed to a thread at once.
+ * @param pool Pointer to the pool.
+ * @param grain Minimum number of elements per chunk (must be > 0).
+ * @note inputs of at most grain elements run serially on the calling thread, where splitting costs more than it saves. raise it for cheap callbacks, lower it for expensive ones.
+ * @return 0 on success, -1 on failure.
+ */
+int thread_pool_set_grain(thread_pool *pool, ssize_t grain);
+
+/**
+ * @brief Number of chunks to split count elements into.
+ * @param pool Pointer to the pool (can be NULL, meaning serial).
+ * @param count Number of elements.
+ * @note a few chunks per thread so uneven chunks balance out, never smaller than the grain.
+ * @return Number of chunks, 1 when the work should run serially.
+ */
+ssize_t thread_pool_chunks(const thread_pool *pool, ssize_t count);
+
+/**
+ * @brief Run job once for every chunk in [0, chunks), spread over the pool, and wait for all of them.
+ * @param pool Pointer to the pool (can be NULL, then every chunk runs on the caller).
+ * @param chunks Number of chunks.
+ * @param job Function to run, receiving ctx and the chunk number.
+ * @param ctx Context passed to job.
+ * @note chunks run in no particular order and concurrently, job must only touch data private to its chunk or synchronize itself. called from inside a job of the same pool, the chunks all run on the calling thread.
+ * @return 0 on success, -1 on failure.
+ */
+int thread_pool_run(thread_pool *pool, ssize_t chunks, void (*job) (void* ctx, ssize_t chunk), void* ctx);
+
+/**
+ * @brief Stop the workers and free the pool.
+ * @param pool Pointer to the pool.
+ * @note must not be called while a job is running.
+ */
+void free_thread_pool(thread_pool *pool);
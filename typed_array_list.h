@@ -0,0 +1,143 @@
+#pragma once
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/types.h>
+
+/**
+ * @file typed_array_list.h
+ * @brief Compile-time instantiation of array_list for a concrete element type.
+ *
+ * DEFINE_TYPED_ARRAY_LIST(name, T, compare, free_element) defines the type `name` and static inline
+ * functions name_create, name_free, name_get_index, name_reverse, name_get, name_at, name_set,
+ * name_append, name_add, name_pop and name_delete. They follow the array_list.h contracts, but the
+ * elements are stored as T (by value) and compare/free_element are expanded in place, so the compiler
+ * can inline them and vectorize the loops around them.
+ *
+ * compare(a, b) must evaluate to 0 when the two T values match (same contract as alget_index), and
+ * free_element(x) releases what a T value owns. Both can be function names or function-like macros,
+ * e.g. TYPED_EQ_COMPARE and TYPED_NO_FREE below.
+ *
+ * DEFINE_TYPED_ARRAY_LIST(ptr_list, void*, cmp, TYPED_NO_FREE) reproduces the generic array_list
+ * (minus the runtime callbacks), which stays available as the void* instantiation.
+ */
+
+/** @brief compare for scalar types: 0 when equal, -1 otherwise. */
+#define TYPED_EQ_COMPARE(a, b) ((a) == (b) ? 0 : -1)
+
+/** @brief compare for any type: byte-wise equality (a and b must be lvalues). */
+#define TYPED_MEMCMP_COMPARE(a, b) (memcmp(&(a), &(b), sizeof(a)) == 0 ? 0 : -1)
+
+/** @brief free_element for values that own nothing. */
+#define TYPED_NO_FREE(x) ((void)0)
+
+#define DEFINE_TYPED_ARRAY_LIST(name, T, compare, free_element)                                   \
+                                                                                                   \
+typedef struct {                                                                                   \
+    ssize_t length;                                                                                \
+    ssize_t max_size;                                                                              \
+    T* arr;                                                                                        \
+} name;                                                                                            \
+                                                                                                   \
+static inline name* name##_create(ssize_t array_size){                                            \
+    ssize_t size = (array_size > 0 ? array_size : 10);                                             \
+    if ((size_t)size > SIZE_MAX / sizeof(T)) return NULL;                                          \
+    name* list = malloc(sizeof(name));                                                             \
+    if (list == NULL) return NULL;                                                                 \
+    list->arr = malloc(sizeof(T) * (size_t)size);                                                  \
+    if (list->arr == NULL){                                                                        \
+        free(list);                                                                                \
+        return NULL;                                                                               \
+    }                                                                                              \
+    list->length = 0;                                                                              \
+    list->max_size = size;                                                                         \
+    return list;                                                                                   \
+}                                                                                                  \
+                                                                                                   \
+static inline void name##_free(name* list){                                                       \
+    if (list == NULL) return;                                                                      \
+    for (ssize_t i = 0; i < list->length; i++) free_element(list->arr[i]);                         \
+    free(list->arr);                                                                               \
+    free(list);                                                                                    \
+}                                                                                                  \
+                                                                                                   \
+static inline ssize_t name##_get_index(const name* list, T element){                              \
+    if (list == NULL) return -1;                                                                   \
+    for (ssize_t i = 0; i < list->length; i++)                                                     \
+        if (compare(list->arr[i], element) == 0) return i;                                         \
+    return -1;                                                                                     \
+}                                                                                                  \
+                                                                                                   \
+static inline void name##_reverse(name* list){                                                    \
+    if (list == NULL) return;                                                                      \
+    for (ssize_t i = 0, j = list->length - 1; i < j; i++, j--){                                    \
+        T temp = list->arr[i];                                                                     \
+        list->arr[i] = list->arr[j];                                                               \
+        list->arr[j] = temp;                                                                       \
+    }                                                                                              \
+}                                                                                                  \
+                                                                                                   \
+static inline T* name##_at(const name* list, ssize_t index){                                      \
+    if (list == NULL || index < 0 || index >= list->length) return NULL;                           \
+    return &list->arr[index];                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_get(const name* list, ssize_t index, T* out){                            \
+    if (list == NULL || out == NULL || index < 0 || index >= list->length) return -1;              \
+    *out = list->arr[index];                                                                       \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_set(name* list, ssize_t index, T element){                               \
+    if (list == NULL || index < 0 || index >= list->length) return -1;                             \
+    free_element(list->arr[index]);                                                                \
+    list->arr[index] = element;                                                                    \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_resize(name* list){                                                      \
+    if ((size_t)list->max_size > SIZE_MAX / 2 / sizeof(T)) return -1;                              \
+    T* new_arr = realloc(list->arr, (size_t)list->max_size * 2 * sizeof(T));                       \
+    if (new_arr == NULL) return -1;                                                                \
+    list->arr = new_arr;                                                                           \
+    list->max_size *= 2;                                                                           \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_append(name* list, T element){                                           \
+    if (list == NULL) return -1;                                                                   \
+    if (list->length >= list->max_size)                                                            \
+        if (name##_resize(list) == -1) return -1;                                                  \
+    list->arr[list->length] = element;                                                             \
+    list->length++;                                                                                \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_add(name* list, ssize_t index, T element){                               \
+    if (list == NULL || index < 0 || index > list->length) return -1;                              \
+    if (list->length >= list->max_size)                                                            \
+        if (name##_resize(list) == -1) return -1;                                                  \
+    memmove(&list->arr[index + 1], &list->arr[index], (size_t)(list->length - index) * sizeof(T)); \
+    list->arr[index] = element;                                                                    \
+    list->length++;                                                                                \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+/* out receives the removed element (ownership moves to the caller); when out is NULL it is freed */ \
+static inline int name##_pop(name* list, T* out){                                                 \
+    if (list == NULL || list->length <= 0) return -1;                                              \
+    list->length--;                                                                                \
+    if (out != NULL) *out = list->arr[list->length];                                               \
+    else free_element(list->arr[list->length]);                                                    \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_delete(name* list, ssize_t index, T* out){                               \
+    if (list == NULL || index < 0 || index >= list->length) return -1;                             \
+    if (out != NULL) *out = list->arr[index];                                                      \
+    else free_element(list->arr[index]);                                                           \
+    memmove(&list->arr[index], &list->arr[index + 1], (size_t)(list->length - 1 - index) * sizeof(T)); \
+    list->length--;                                                                                \
+    return 0;                                                                                      \
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include <stdlib.h>
+#include <sys/types.h>
+#include "typed_array_list.h"
+
+/**
+ * @file typed_linked_list.h
+ * @brief Compile-time instantiation of linked_list for a concrete element type.
+ *
+ * DEFINE_TYPED_LINKED_LIST(name, T, compare, free_element) defines the types `name` and
+ * `name##_node` (a doubly linked node holding the T value inline, so there is one allocation per
+ * element instead of two) and static inline functions name_create, name_free, name_get_index,
+ * name_reverse, name_get_node, name_get, name_set, name_append, name_add, name_pop and name_delete
+ * following the linked_list.h contracts. compare and free_element follow the rules in
+ * typed_array_list.h.
+ */
+
+#define DEFINE_TYPED_LINKED_LIST(name, T, compare, free_element)                                  \
+                                                                                                   \
+typedef struct name##_node {                                                                       \
+    T value;                                                                                       \
+    struct name##_node* next;                                                                      \
+    struct name##_node* prev;                                                                      \
+} name##_node;                                                                                     \
+                                                                                                   \
+typedef struct {                                                                                   \
+    name##_node* head;                                                                             \
+    name##_node* tail;                                                                             \
+    ssize_t length;                                                                                \
+} name;                                                                                            \
+                                                                                                   \
+static inline name* name##_create(void){                                                          \
+    name* list = malloc(sizeof(name));                                                             \
+    if (list == NULL) return NULL;                                                                 \
+    list->head = NULL;                                                                             \
+    list->tail = NULL;                                                                             \
+    list->length = 0;                                                                              \
+    return list;                                                                                   \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_free(name* list){                                                        \
+    if (list == NULL) return -1;                                                                   \
+    name##_node* current = list->head;                                                             \
+    while (current != NULL){                                                                       \
+        name##_node* temp_next = current->next;                                                    \
+        free_element(current->value);                                                              \
+        free(current);                                                                             \
+        current = temp_next;                                                                       \
+    }                                                                                              \
+    free(list);                                                                                    \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline ssize_t name##_get_index(const name* list, T element){                              \
+    if (list == NULL) return -1;                                                                   \
+    ssize_t index = 0;                                                                             \
+    for (name##_node* current = list->head; current != NULL; current = current->next, index++)    \
+        if (compare(current->value, element) == 0) return index;                                   \
+    return -1;                                                                                     \
+}                                                                                                  \
+                                                                                                   \
+static inline void name##_reverse(name* list){                                                    \
+    if (list == NULL) return;                                                                      \
+    name##_node* current = list->head;                                                             \
+    while (current != NULL){                                                                       \
+        name##_node* next = current->next;                                                         \
+        current->next = current->prev;                                                             \
+        current->prev = next;                                                                      \
+        current = next;                                                                            \
+    }                                                                                              \
+    name##_node* temp_head = list->head;                                                           \
+    list->head = list->tail;                                                                       \
+    list->tail = temp_head;                                                                        \
+}                                                                                                  \
+                                                                                                   \
+static inline name##_node* name##_get_node(const name* list, ssize_t index){                      \
+    if (list == NULL || index < 0 || index >= list->length) return NULL;                           \
+    name##_node* current;                                                                          \
+    if (index < list->length / 2){                                                                 \
+        current = list->head;                                                                      \
+        for (ssize_t i = 0; i < index; i++) current = current->next;                               \
+    } else {                                                                                       \
+        current = list->tail;                                                                      \
+        for (ssize_t i = list->length - 1; i > index; i--) current = current->prev;                \
+    }                                                                                              \
+    return current;                                                                                \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_get(const name* list, ssize_t index, T* out){                            \
+    name##_node* nd = name##_get_node(list, index);                                                \
+    if (nd == NULL || out == NULL) return -1;                                                      \
+    *out = nd->value;                                                                              \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_set(name* list, ssize_t index, T element){                               \
+    name##_node* nd = name##_get_node(list, index);                                                \
+    if (nd == NULL) return -1;                                                                     \
+    free_element(nd->value);                                                                       \
+    nd->value = element;                                                                           \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_add(name* list, ssize_t index, T element){                               \
+    if (list == NULL || index < 0 || index > list->length) return -1;                              \
+    name##_node* newnode = malloc(sizeof(name##_node));                                            \
+    if (newnode == NULL) return -1;                                                                \
+    newnode->value = element;                                                                      \
+    /* link after the node currently at index - 1 (or as the head) */                              \
+    name##_node* prenode = (index == list->length ? list->tail : name##_get_node(list, index - 1)); \
+    newnode->prev = prenode;                                                                       \
+    newnode->next = (prenode == NULL ? list->head : prenode->next);                                \
+    if (newnode->next != NULL) newnode->next->prev = newnode;                                      \
+    else list->tail = newnode;                                                                     \
+    if (prenode != NULL) prenode->next = newnode;                                                  \
+    else list->head = newnode;                                                                     \
+    list->length++;                                                                                \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_append(name* list, T element){                                           \
+    if (list == NULL) return -1;                                                                   \
+    return name##_add(list, list->length, element);                                                \
+}                                                                                                  \
+                                                                                                   \
+/* out receives the removed element (ownership moves to the caller); when out is NULL it is freed */ \
+static inline int name##_delete(name* list, ssize_t index, T* out){                               \
+    name##_node* nd = name##_get_node(list, index);                                                \
+    if (nd == NULL) return -1;                                                                     \
+    if (nd->prev != NULL) nd->prev->next = nd->next;                                               \
+    else list->head = nd->next;                                                                    \
+    if (nd->next != NULL) nd->next->prev = nd->prev;                                               \
+    else list->tail = nd->prev;                                                                    \
+    if (out != NULL) *out = nd->value;                                                             \
+    else free_element(nd->value);                                                                  \
+    free(nd);                                                                                      \
+    list->length--;                                                                                \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_pop(name* list, T* out){                                                 \
+    if (list == NULL) return -1;                                                                   \
+    return name##_delete(list, list->length - 1, out);                                             \
+}
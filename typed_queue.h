@@ -0,0 +1,96 @@
+#pragma once
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <sys/types.h>
+#include "typed_array_list.h"
+
+/**
+ * @file typed_queue.h
+ * @brief Compile-time instantiation of queue for a concrete element type.
+ *
+ * DEFINE_TYPED_QUEUE(name, T, free_element) defines the type `name`, a growable circular array of T
+ * (the layout of the QUEUE_RING_BUFFER backend), and static inline functions name_create,
+ * name_enqueue, name_dequeue, name_front and name_free following the queue.h contracts with T values
+ * instead of void*.
+ */
+
+#define DEFINE_TYPED_QUEUE(name, T, free_element)                                                 \
+                                                                                                   \
+typedef struct {                                                                                   \
+    T* ring;                                                                                       \
+    ssize_t head;                                                                                  \
+    ssize_t length;                                                                                \
+    ssize_t capacity;                                                                              \
+} name;                                                                                            \
+                                                                                                   \
+static inline name* name##_create(ssize_t init_size){                                             \
+    ssize_t capacity = 16;                                                                         \
+    if (init_size > 0){                                                                            \
+        if (init_size > SSIZE_MAX / 2) return NULL;                                                \
+        if ((size_t)init_size > SIZE_MAX / 2 / sizeof(T)) return NULL;                             \
+        capacity = 1;                                                                              \
+        while (capacity < init_size) capacity *= 2;                                                \
+    }                                                                                              \
+    if ((size_t)capacity > SIZE_MAX / sizeof(T)) return NULL;                                      \
+    name* qu = malloc(sizeof(name));                                                               \
+    if (qu == NULL) return NULL;                                                                   \
+    qu->ring = malloc(sizeof(T) * (size_t)capacity);                                               \
+    if (qu->ring == NULL){                                                                         \
+        free(qu);                                                                                  \
+        return NULL;                                                                               \
+    }                                                                                              \
+    qu->head = 0;                                                                                  \
+    qu->length = 0;                                                                                \
+    qu->capacity = capacity;                                                                       \
+    return qu;                                                                                     \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_resize(name* qu){                                                        \
+    if (qu->capacity > SSIZE_MAX / 2) return -1;                                                   \
+    if ((size_t)qu->capacity > SIZE_MAX / 2 / sizeof(T)) return -1;                                \
+    T* new_ring = malloc(sizeof(T) * (size_t)qu->capacity * 2);                                    \
+    if (new_ring == NULL) return -1;                                                               \
+    ssize_t first_part = qu->capacity - qu->head;                                                  \
+    memcpy(new_ring, &qu->ring[qu->head], (size_t)first_part * sizeof(T));                         \
+    memcpy(&new_ring[first_part], qu->ring, (size_t)qu->head * sizeof(T));                         \
+    free(qu->ring);                                                                                \
+    qu->ring = new_ring;                                                                           \
+    qu->head = 0;                                                                                  \
+    qu->capacity *= 2;                                                                             \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_enqueue(name* qu, T element){                                            \
+    if (qu == NULL) return -1;                                                                     \
+    if (qu->length == qu->capacity)                                                                \
+        if (name##_resize(qu) == -1) return -1;                                                    \
+    qu->ring[(qu->head + qu->length) & (qu->capacity - 1)] = element;                              \
+    qu->length++;                                                                                  \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+/* ownership of the dequeued element moves to the caller */                                        \
+static inline int name##_dequeue(name* qu, T* out){                                               \
+    if (qu == NULL || out == NULL || qu->length == 0) return -1;                                   \
+    *out = qu->ring[qu->head];                                                                     \
+    qu->head = (qu->head + 1) & (qu->capacity - 1);                                                \
+    qu->length--;                                                                                  \
+    return 0;                                                                                      \
+}                                                                                                  \
+                                                                                                   \
+static inline T* name##_front(name* qu){                                                          \
+    if (qu == NULL || qu->length == 0) return NULL;                                                \
+    return &qu->ring[qu->head];                                                                    \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_free(name* qu){                                                          \
+    if (qu == NULL) return -1;                                                                     \
+    for (ssize_t i = 0; i < qu->length; i++)                                                       \
+        free_element(qu->ring[(qu->head + i) & (qu->capacity - 1)]);                               \
+    free(qu->ring);                                                                                \
+    free(qu);                                                                                      \
+    return 0;                                                                                      \
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "typed_array_list.h"
+
+/**
+ * @file typed_stack.h
+ * @brief Compile-time instantiation of stack for a concrete element type.
+ *
+ * DEFINE_TYPED_STACK(name, T, free_element) defines the type `name`, built on a typed array list
+ * `name##_storage`, and static inline functions name_create, name_push, name_pop, name_peek and
+ * name_free following the stack.h contracts with T values instead of void*.
+ */
+
+#define DEFINE_TYPED_STACK(name, T, free_element)                                                 \
+                                                                                                   \
+DEFINE_TYPED_ARRAY_LIST(name##_storage, T, TYPED_MEMCMP_COMPARE, free_element)                     \
+                                                                                                   \
+typedef struct {                                                                                   \
+    name##_storage* arr;                                                                           \
+} name;                                                                                            \
+                                                                                                   \
+static inline name* name##_create(ssize_t init_size){                                             \
+    name* stck = malloc(sizeof(name));                                                             \
+    if (stck == NULL) return NULL;                                                                 \
+    stck->arr = name##_storage_create(init_size);                                                  \
+    if (stck->arr == NULL){                                                                        \
+        free(stck);                                                                                \
+        return NULL;                                                                               \
+    }                                                                                              \
+    return stck;                                                                                   \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_push(name* stck, T element){                                             \
+    if (stck == NULL) return -1;                                                                   \
+    return name##_storage_append(stck->arr, element);                                              \
+}                                                                                                  \
+                                                                                                   \
+/* ownership of the popped element moves to the caller */                                          \
+static inline int name##_pop(name* stck, T* out){                                                 \
+    if (stck == NULL || out == NULL) return -1;                                                    \
+    return name##_storage_pop(stck->arr, out);                                                     \
+}                                                                                                  \
+                                                                                                   \
+static inline T* name##_peek(name* stck){                                                         \
+    if (stck == NULL) return NULL;                                                                 \
+    return name##_storage_at(stck->arr, stck->arr->length - 1);                                    \
+}                                                                                                  \
+                                                                                                   \
+static inline int name##_free(name* stck){                                                        \
+    if (stck == NULL) return -1;                                                                   \
+    name##_storage_free(stck->arr);                                                                \
+    free(stck);                                                                                    \
+    return 0;                                                                                      \
+}
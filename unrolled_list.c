@@ -0,0 +1,261 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/types.h>
+#include "unrolled_list.h"
+
+static unrolled_node* create_unrolled_node(){
+    unrolled_node* n = malloc(sizeof(unrolled_node));
+
+    if (n == NULL) return NULL;
+
+    n->next = NULL;
+    n->prev = NULL;
+    n->count = 0;
+
+    return n;
+}
+
+// link n right after pos (or as the head when pos is NULL)
+static void link_after(unrolled_list* list, unrolled_node* pos, unrolled_node* n){
+    n->prev = pos;
+    n->next = (pos == NULL ? list->head : pos->next);
+
+    if (n->next != NULL) n->next->prev = n;
+    else list->tail = n;
+
+    if (pos != NULL) pos->next = n;
+    else list->head = n;
+}
+
+static void unlink_node(unrolled_list* list, unrolled_node* n){
+    if (n->prev != NULL) n->prev->next = n->next;
+    else list->head = n->next;
+
+    if (n->next != NULL) n->next->prev = n->prev;
+    else list->tail = n->prev;
+
+    free(n);
+}
+
+// find the node holding index, walking from the closer end, and the index's offset inside that node
+static unrolled_node* find_node(const unrolled_list* list, ssize_t index, ssize_t* offset){
+    unrolled_node* current;
+
+    if (index < list->length / 2){
+        current = list->head;
+        while (index >= current->count){
+            index -= current->count;
+            current = current->next;
+        }
+    } else {
+        ssize_t from_end = list->length - 1 - index;
+        current = list->tail;
+        while (from_end >= current->count){
+            from_end -= current->count;
+            current = current->prev;
+        }
+        index = current->count - 1 - from_end;
+    }
+
+    *offset = index;
+    return current;
+}
+
+unrolled_list* create_unrolled_list(){
+    unrolled_list* list = malloc(sizeof(unrolled_list));
+
+    if (list == NULL) return NULL;
+
+    list->head = NULL;
+    list->tail = NULL;
+    list->length = 0;
+
+    return list;
+}
+
+int free_unrolled_list(unrolled_list* list, void (*free_element)(void*)){
+    if (list == NULL) return -1;
+
+    unrolled_node* delete_pointer = list->head;
+    unrolled_node* temp_next;
+
+    while (delete_pointer != NULL){
+        temp_next = delete_pointer->next;
+        if (free_element != NULL)
+            for (ssize_t i = 0; i < delete_pointer->count; i++)
+                free_element(delete_pointer->values[i]);
+        free(delete_pointer);
+        delete_pointer = temp_next;
+    }
+
+    free(list);
+
+    return 0;
+}
+
+ssize_t ulget_index(const unrolled_list* list, void* element, int (*compare) (void*, void*)){
+    if (list == NULL || element == NULL || compare == NULL) return -1;
+
+    ssize_t base = 0;
+
+    for (unrolled_node* current = list->head; current != NULL; current = current->next){
+        for (ssize_t i = 0; i < current->count; i++)
+            if (compare(current->values[i], element) == 0) return base + i;
+        base += current->count;
+    }
+
+    return -1;
+}
+
+void ulprint(const unrolled_list* list, void (*print_element) (void*)){
+    if (list == NULL || list->length == 0 || print_element == NULL) {
+        printf("[]\n");
+        return;
+    }
+
+    printf("[");
+
+    for (unrolled_node* current = list->head; current != NULL; current = current->next){
+        for (ssize_t i = 0; i < current->count; i++){
+            print_element(current->values[i]);
+            printf(", ");
+        }
+    }
+
+    printf("\b\b]\n");
+}
+
+void ulreverse(unrolled_list* list){
+    if (list == NULL) return;
+
+    unrolled_node* current = list->head;
+
+    while (current != NULL){
+        // reverse the elements inside the node, then flip its links
+        for (ssize_t i = 0, j = current->count - 1; i < j; i++, j--){
+            void* temp = current->values[i];
+            current->values[i] = current->values[j];
+            current->values[j] = temp;
+        }
+
+        unrolled_node* next = current->next;
+        current->next = current->prev;
+        current->prev = next;
+        current = next;
+    }
+
+    unrolled_node* temp_head = list->head;
+
+    list->head = list->tail;
+    list->tail = temp_head;
+}
+
+void* ulget(const unrolled_list* list, ssize_t index){
+    if (list == NULL || index < 0 || index >= list->length) return NULL;
+
+    ssize_t offset;
+    unrolled_node* n = find_node(list, index, &offset);
+
+    return n->values[offset];
+}
+
+int ulset(unrolled_list* list, ssize_t index, void* element, void (*free_element) (void*)){
+    if (list == NULL || element == NULL || index < 0 || index >= list->length) return -1;
+
+    ssize_t offset;
+    unrolled_node* n = find_node(list, index, &offset);
+
+    if (free_element != NULL) free_element(n->values[offset]);
+
+    n->values[offset] = element;
+
+    return 0;
+}
+
+int ulappend(unrolled_list* list, void* element){
+    if (list == NULL || element == NULL) return -1;
+
+    if (list->tail == NULL || list->tail->count == UNROLLED_NODE_CAPACITY){
+        unrolled_node* n = create_unrolled_node();
+        if (n == NULL) return -1;
+        link_after(list, list->tail, n);
+    }
+
+    list->tail->values[list->tail->count] = element;
+    list->tail->count++;
+    list->length++;
+
+    return 0;
+}
+
+int uladd(unrolled_list* list, ssize_t index, void* element){
+    if (list == NULL || element == NULL) return -1;
+
+    if (index < 0 || index > list->length) return -1;
+
+    if (index == list->length) return ulappend(list, element);
+
+    ssize_t offset;
+    unrolled_node* n = find_node(list, index, &offset);
+
+    if (n->count == UNROLLED_NODE_CAPACITY){
+        unrolled_node* split = create_unrolled_node();
+        if (split == NULL) return -1;
+
+        // move the upper half of the full node into a new node right after it
+        ssize_t keep = n->count / 2;
+        split->count = n->count - keep;
+        memcpy(split->values, &n->values[keep], split->count * sizeof(void*));
+        n->count = keep;
+        link_after(list, n, split);
+
+        if (offset > keep){
+            offset -= keep;
+            n = split;
+        }
+    }
+
+    memmove(&n->values[offset + 1], &n->values[offset], (n->count - offset) * sizeof(void*));
+    n->values[offset] = element;
+    n->count++;
+    list->length++;
+
+    return 0;
+}
+
+int ulpop(unrolled_list* list, void (*free_element)(void*)){
+    if (list == NULL) return -1;
+    return uldelete(list, list->length - 1, free_element);
+}
+
+int uldelete(unrolled_list* list, ssize_t index, void (*free_element)(void*)){
+    if (list == NULL) return -1;
+
+    if (index < 0 || index >= list->length) return -1;
+
+    ssize_t offset;
+    unrolled_node* n = find_node(list, index, &offset);
+
+    if (free_element != NULL) free_element(n->values[offset]);
+
+    memmove(&n->values[offset], &n->values[offset + 1], (n->count - offset - 1) * sizeof(void*));
+    n->count--;
+    list->length--;
+
+    if (n->count == 0){
+        unlink_node(list, n);
+        return 0;
+    }
+
+    // a node under half full folds its successor in when both fit in one node. this limits
+    // fragmentation but doesn't guarantee any fill: a small node with a full successor stays as is
+    unrolled_node* next = n->next;
+    if (n->count < UNROLLED_NODE_CAPACITY / 2 && next != NULL && n->count + next->count <= UNROLLED_NODE_CAPACITY){
+        memcpy(&n->values[n->count], next->values, next->count * sizeof(void*));
+        n->count += next->count;
+        unlink_node(list, next);
+    }
+
+    return 0;
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <sys/types.h>
+
+#ifndef UNROLLED_NODE_CAPACITY
+/**
+ * @brief Number of element pointers stored per node.
+ * @note 29 pointers plus the node header make a 256-byte node (four cache lines).
+ */
+#define UNROLLED_NODE_CAPACITY 29
+#endif
+
+/**
+ * @brief Node structure for unrolled linked list.
+ */
+typedef struct unrolled_node {
+    struct unrolled_node* next;              /**< Pointer to the next node in the list */
+    struct unrolled_node* prev;              /**< Pointer to the previous node in the list */
+    ssize_t count;                           /**< Number of elements used in this node */
+    void* values[UNROLLED_NODE_CAPACITY];    /**< Pointers to the data stored in the node, in list order */
+} unrolled_node;
+
+/**
+ * @brief Unrolled linked list structure: a linked list whose nodes each hold a small array of elements.
+ * @note scans touch one node per UNROLLED_NODE_CAPACITY elements instead of one per element, and the per-element overhead is close to the size of the element pointer itself.
+ */
+typedef struct {
+    unrolled_node* head;  /**< Pointer to the first node */
+    unrolled_node* tail;  /**< Pointer to the last node */
+    ssize_t length;       /**< Number of elements in the list */
+} unrolled_list;
+
+/**
+ * @brief Create an empty unrolled linked list.
+ * @return Pointer to the newly created list, or NULL on failure.
+ */
+unrolled_list *create_unrolled_list();
+
+/**
+ * @brief Free the list and its nodes.
+ * @param list Pointer to the unrolled list.
+ * @param free_element Function pointer to free the elements (can be NULL).
+ * @note memory ownership rules in free_linked_list apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int free_unrolled_list(unrolled_list *list, void (*free_element)(void*));
+
+/**
+ * @brief Get the index of an element in the list.
+ * @param list Pointer to the unrolled list.
+ * @param element Pointer to the element to find.
+ * @param compare Function pointer to compare the passed element with the list elements.
+ * @note compare passed function should return 0 on success (the two element match) and -1 on failure.
+ * @return Index of the element, or -1 if not found.
+ */
+ssize_t ulget_index(const unrolled_list *list, void* element, int (*compare) (void*, void*));
+
+/**
+ * @brief Print the list.
+ * @param list Pointer to the unrolled list.
+ * @param print_element Function pointer to print each element.
+ */
+void ulprint(const unrolled_list *list, void (*print_element) (void*));
+
+/**
+ * @brief Reverse the list in place.
+ * @param list Pointer to the unrolled list.
+ */
+void ulreverse(unrolled_list *list);
+
+/**
+ * @brief Get the element at a specific index.
+ * @param list Pointer to the unrolled list.
+ * @param index Index of the element to retrieve.
+ * @note the walk starts from whichever end of the list is closer to the index.
+ * @return Pointer to the element, or NULL if index is out of range.
+ */
+void *ulget(const unrolled_list *list, ssize_t index);
+
+/**
+ * @brief Set the element at a specific index.
+ * @param list Pointer to the unrolled list.
+ * @param index Index of the element to set.
+ * @param element Pointer to the new element.
+ * @param free_element Function pointer to free the old element (can be NULL).
+ * @note the old element will no longer be in the list, so if the list owns it, free it using the provided function; otherwise, pass NULL.
+ * @return 0 on success, -1 on failure.
+ */
+int ulset(unrolled_list *list, ssize_t index, void* element, void (*free_element) (void*));
+
+/**
+ * @brief Append an element to the end of the list.
+ * @param list Pointer to the unrolled list.
+ * @param element Pointer to the element to append.
+ * @note appending fills the tail node completely before a new node is allocated.
+ * @return 0 on success, -1 on failure.
+ */
+int ulappend(unrolled_list *list, void* element);
+
+/**
+ * @brief Add an element at a specific index.
+ * @param list Pointer to the unrolled list.
+ * @param index Index at which to insert the element.
+ * @param element Pointer to the element to add.
+ * @note inserting into a full node splits it in two half full nodes.
+ * @return 0 on success, -1 on failure.
+ */
+int uladd(unrolled_list *list, ssize_t index, void* element);
+
+/**
+ * @brief Remove the last element from the list.
+ * @param list Pointer to the unrolled list.
+ * @param free_element Function pointer to free the element (can be NULL).
+ * @note memory ownership rules in free_linked_list apply here.
+ * @return 0 on success, -1 on failure.
+ */
+int ulpop(unrolled_list *list, void (*free_element)(void*));
+
+/**
+ * @brief Delete the element at a specific index.
+ * @param list Pointer to the unrolled list.
+ * @param index Index of the element to delete.
+ * @param free_element Function pointer to free the element (can be NULL).
+ * @note a node falling under half full is merged with its successor when both fit in one node.
+ * @return 0 on success, -1 on failure.
+ */
+int uldelete(unrolled_list *list, ssize_t index, void (*free_element)(void*));
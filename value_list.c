@@ -0,0 +1,215 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/types.h>
+#include "value_list.h"
+#include "simd_search.h"
+
+// address of the slot at index
+#define SLOT(list, index) ((char*)(list)->arr + (size_t)(index) * (size_t)(list)->element_size)
+
+value_list* create_value_list(ssize_t element_size, ssize_t array_size){
+    if (element_size <= 0) return NULL;
+
+    ssize_t size;
+    // check if init_size is specified, if it <= 0 a default size of 10 is used
+    if (array_size > 0)
+        size = array_size;
+    else
+        size = 10;
+
+    if ((size_t)size > SIZE_MAX / (size_t)element_size) return NULL;
+
+    value_list* list = malloc(sizeof(value_list));
+
+    if (list == NULL) return NULL;
+
+    list->arr = malloc((size_t)size * (size_t)element_size);
+
+    if (list->arr == NULL){
+        free(list);
+        return NULL;
+    }
+
+    list->length = 0;
+    list->max_size = size;
+    list->element_size = element_size;
+
+    return list;
+}
+
+void free_value_list(value_list *list, void (*free_element) (void*)){
+    if (list == NULL) return;
+
+    if (free_element != NULL)
+        for (ssize_t i = 0; i < list->length; i++)
+            free_element(SLOT(list, i));
+
+    free(list->arr);
+    free(list);
+}
+
+ssize_t vlget_index(const value_list *list, const void* element, int (*compare) (void*, void*)){
+    if (list == NULL || element == NULL) return -1;
+
+    for (ssize_t i = 0; i < list->length; i++){
+        if (compare != NULL){
+            if (compare(SLOT(list, i), (void*)element) == 0) return i;
+        } else if (memcmp(SLOT(list, i), element, list->element_size) == 0){
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+ssize_t vlfind_int32(const value_list *list, int32_t key){
+    if (list == NULL || list->element_size != sizeof(int32_t)) return -1;
+
+    return simd_find_u32(list->arr, list->length, (uint32_t)key);
+}
+
+ssize_t vlfind_int64(const value_list *list, int64_t key){
+    if (list == NULL || list->element_size != sizeof(int64_t)) return -1;
+
+    return simd_find_u64(list->arr, list->length, (uint64_t)key);
+}
+
+void vlprint(const value_list *list, void (*print_element) (void*)){
+    if (list == NULL || list->length == 0 || print_element == NULL) {
+        printf("[]\n");
+        return;
+    }
+
+    printf("[");
+
+    for (ssize_t i = 0; i < list->length; i++){
+        print_element(SLOT(list, i));
+        printf(", ");
+    }
+
+    printf("\b\b]\n");
+}
+
+void vlreverse(value_list *list){
+    if (list == NULL) return;
+
+    ssize_t index1 = 0, index2 = list->length - 1;
+    char temp[256];
+
+    while (index1 < index2){
+        char* a = SLOT(list, index1);
+        char* b = SLOT(list, index2);
+        // swap through a stack buffer, a chunk at a time for elements bigger than it
+        for (ssize_t done = 0; done < list->element_size; done += sizeof(temp)){
+            size_t chunk = (size_t)(list->element_size - done) < sizeof(temp) ? (size_t)(list->element_size - done) : sizeof(temp);
+            memcpy(temp, a + done, chunk);
+            memcpy(a + done, b + done, chunk);
+            memcpy(b + done, temp, chunk);
+        }
+        index1++;
+        index2--;
+    }
+}
+
+void *vlat(const value_list *list, ssize_t index){
+    if (list == NULL || index < 0 || index >= list->length) return NULL;
+    return SLOT(list, index);
+}
+
+int vlget(const value_list *list, ssize_t index, void* out){
+    if (list == NULL || out == NULL || index < 0 || index >= list->length) return -1;
+
+    memcpy(out, SLOT(list, index), list->element_size);
+
+    return 0;
+}
+
+int vlset(value_list *list, ssize_t index, const void* element){
+    if (list == NULL || element == NULL || index < 0 || index >= list->length) return -1;
+
+    memcpy(SLOT(list, index), element, list->element_size);
+
+    return 0;
+}
+
+static int resize_value_list(value_list* list){
+    // refuse to grow past what a size_t byte count can address
+    if ((size_t)list->max_size > SIZE_MAX / 2 / (size_t)list->element_size) return -1;
+
+    void *new_arr = realloc(list->arr, (size_t)list->max_size * 2 * (size_t)list->element_size);
+    if (new_arr == NULL) return -1;
+    list->arr = new_arr;
+    list->max_size *= 2;
+    return 0;
+}
+
+// byte offset of element inside the stored values, or -1 when it points elsewhere
+static ssize_t offset_in_list(const value_list* list, const void* element){
+    uintptr_t begin = (uintptr_t)list->arr, address = (uintptr_t)element;
+
+    if (address < begin || address >= begin + (size_t)list->length * (size_t)list->element_size) return -1;
+
+    return (ssize_t)(address - begin);
+}
+
+int vlappend(value_list *list, const void* element){
+    if (list == NULL || element == NULL) return -1;
+
+    // a value taken from the list itself (e.g. vlat) must be found again after the realloc
+    ssize_t offset = offset_in_list(list, element);
+
+    if (list->length >= list->max_size)
+        if (resize_value_list(list) == -1) return -1;
+
+    if (offset != -1) element = (char*)list->arr + offset;
+
+    memcpy(SLOT(list, list->length), element, list->element_size);
+    list->length++;
+
+    return 0;
+}
+
+int vladd(value_list *list, ssize_t index, const void* element){
+    if (list == NULL || element == NULL || index < 0 || index > list->length) return -1;
+
+    ssize_t offset = offset_in_list(list, element);
+
+    if (list->length >= list->max_size)
+        if (resize_value_list(list) == -1) return -1;
+
+    memmove(SLOT(list, index + 1), SLOT(list, index), (size_t)(list->length - index) * list->element_size);
+
+    // a value from the list moved with the realloc, and one slot further if the shift covered it
+    if (offset != -1){
+        if (offset >= index * list->element_size) offset += list->element_size;
+        element = (char*)list->arr + offset;
+    }
+
+    memcpy(SLOT(list, index), element, list->element_size);
+    list->length++;
+
+    return 0;
+}
+
+int vlpop(value_list *list, void* out){
+    if (list == NULL || list->length <= 0) return -1;
+
+    if (out != NULL) memcpy(out, SLOT(list, list->length - 1), list->element_size);
+
+    list->length--;
+
+    return 0;
+}
+
+int vldelete(value_list *list, ssize_t index, void* out){
+    if (list == NULL || index < 0 || index >= list->length) return -1;
+
+    if (out != NULL) memcpy(out, SLOT(list, index), list->element_size);
+
+    memmove(SLOT(list, index), SLOT(list, index + 1), (size_t)(list->length - 1 - index) * list->element_size);
+    list->length--;
+
+    return 0;
+}
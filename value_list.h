@@ -0,0 +1,137 @@
+#pragma once
+
+#include <stdint.h>
+#include <sys/types.h>
+
+/**
+ * @brief Array list storing fixed-size elements by value in one contiguous buffer.
+ * @note elements are copied in and out, so there is no allocation per element and no pointer to follow when reading them.
+ */
+typedef struct {
+    ssize_t length;        /**< Number of elements currently in the list */
+    ssize_t max_size;      /**< Maximum capacity of the buffer, in elements */
+    ssize_t element_size;  /**< Size of one element in bytes */
+    void* arr;             /**< Contiguous buffer of max_size elements */
+} value_list;
+
+/**
+ * @brief Create a new value list.
+ * @param element_size Size in bytes of every element (must be > 0).
+ * @param array_size Initial capacity of the list, in elements.
+ * @note if the initial size is <=0 the capacity will be defaulted to 10
+ * @note the capacity doubles when full
+ * @return Pointer to the newly created value list, or NULL on failure.
+ */
+value_list* create_value_list(ssize_t element_size, ssize_t array_size);
+
+/**
+ * @brief Free the value list.
+ * @param list Pointer to the value list.
+ * @param free_element Function pointer called with a pointer to each stored element (can be NULL).
+ * @note the elements live inside the list buffer, so free_element must only release what an element references, never the pointer it receives. pass NULL for plain values.
+ */
+void free_value_list(value_list *list, void (*free_element) (void*));
+
+/**
+ * @brief Get the index of an element in the value list.
+ * @param list Pointer to the value list.
+ * @param element Pointer to a value to find.
+ * @param compare Function pointer to compare two elements (can be NULL).
+ * @note The compare function receives pointers to the values and should return 0 if they match, -1 otherwise. if compare is NULL the values are compared byte by byte.
+ * @return Index of the element, or -1 if not found.
+ */
+ssize_t vlget_index(const value_list *list, const void* element, int (*compare) (void*, void*));
+
+/**
+ * @brief Find a 32-bit integer in a list of int32_t (or uint32_t) elements.
+ * @param list Pointer to a value list whose element_size is 4.
+ * @param key Value to find.
+ * @note compares 4 (SSE2) or 8 (AVX2) elements per instruction when available.
+ * @return Index of the first match, or -1 if not found or the element size isn't 4.
+ */
+ssize_t vlfind_int32(const value_list *list, int32_t key);
+
+/**
+ * @brief Find a 64-bit integer in a list of int64_t (or uint64_t) elements.
+ * @param list Pointer to a value list whose element_size is 8.
+ * @param key Value to find.
+ * @note compares 2 (SSE2) or 4 (AVX2) elements per instruction when available.
+ * @return Index of the first match, or -1 if not found or the element size isn't 8.
+ */
+ssize_t vlfind_int64(const value_list *list, int64_t key);
+
+/**
+ * @brief Print all elements in the value list.
+ * @param list Pointer to the value list.
+ * @param print_element Function pointer to print each element, receiving a pointer to it.
+ */
+void vlprint(const value_list *list, void (*print_element) (void*));
+
+/**
+ * @brief Reverse the value list in place.
+ * @param list Pointer to the value list.
+ */
+void vlreverse(value_list *list);
+
+/**
+ * @brief Get a pointer to the element stored at a specific index.
+ * @param list Pointer to the value list.
+ * @param index Index of the element.
+ * @note the pointer is invalidated by any operation that adds elements (the buffer may move).
+ * @return Pointer to the element inside the list, or NULL if index is out of range.
+ */
+void *vlat(const value_list *list, ssize_t index);
+
+/**
+ * @brief Copy out the element at a specific index.
+ * @param list Pointer to the value list.
+ * @param index Index of the element to retrieve.
+ * @param out Pointer to element_size bytes receiving the value.
+ * @return 0 on success, -1 on failure.
+ */
+int vlget(const value_list *list, ssize_t index, void* out);
+
+/**
+ * @brief Overwrite the element at a specific index.
+ * @param list Pointer to the value list.
+ * @param index Index of the element to set.
+ * @param element Pointer to the new value (element_size bytes are copied).
+ * @return 0 on success, -1 on failure.
+ */
+int vlset(value_list *list, ssize_t index, const void* element);
+
+/**
+ * @brief Append a copy of a value to the end of the list.
+ * @param list Pointer to the value list.
+ * @param element Pointer to the value to append (element_size bytes are copied).
+ * @note element may point into the list itself (e.g. vlat), it is found again if the array moves.
+ * @return 0 on success, -1 on failure.
+ */
+int vlappend(value_list *list, const void* element);
+
+/**
+ * @brief Add a copy of a value at a specific index.
+ * @param list Pointer to the value list.
+ * @param index Index at which to insert the element.
+ * @param element Pointer to the value to add (element_size bytes are copied).
+ * @note element may point into the list itself (e.g. vlat), it is found again if the array moves or the value gets shifted.
+ * @return 0 on success, -1 on failure.
+ */
+int vladd(value_list *list, ssize_t index, const void* element);
+
+/**
+ * @brief Remove the last element from the value list.
+ * @param list Pointer to the value list.
+ * @param out Pointer receiving the removed value (can be NULL).
+ * @return 0 on success, -1 on failure.
+ */
+int vlpop(value_list *list, void* out);
+
+/**
+ * @brief Delete the element at a specific index.
+ * @param list Pointer to the value list.
+ * @param index Index of the element to delete.
+ * @param out Pointer receiving the removed value (can be NULL).
+ * @return 0 on success, -1 on failure.
+ */
+int vldelete(value_list *list, ssize_t index, void* out);